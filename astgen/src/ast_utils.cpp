@@ -1,4 +1,5 @@
 #include "ast_utils.hpp"
+#include "cppmm_naming.hpp"
 #include "pystring.h"
 namespace ps = pystring;
 #include "base64.hpp"
@@ -36,12 +37,7 @@ std::vector<std::string> get_attrs(const clang::Decl* decl) {
 
 /// Strip the type kinds off the front of a type name in the given string
 std::string strip_name_kinds(std::string s) {
-    s = pystring::replace(s, "class ", "");
-    s = pystring::replace(s, "struct ", "");
-    s = pystring::replace(s, "enum ", "");
-    s = pystring::replace(s, "union ", "");
-
-    return s;
+    return cppmm::naming::strip_name_kinds(s);
 }
 
 /// Get a nice, qualified name for the given record
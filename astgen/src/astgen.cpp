@@ -203,15 +203,18 @@ int main(int argc_, const char** argv_) {
 #define CPPMM_IGNORE_UNBOUND __attribute__((annotate("cppmm|ignore_unbound")))
 #define CPPMM_TRIVIALLY_COPYABLE __attribute__((annotate("cppmm|trivially_copyable")))
 #define CPPMM_TRIVIALLY_MOVABLE __attribute__((annotate("cppmm|trivially_movable")))
+#define CPPMM_POOLED __attribute__((annotate("cppmm|pooled")))
 
 #define CPPMM_THROWS(EX, VAR) __attribute__((annotate("cppmm|throws|" #EX "|" #VAR)))
+#define CPPMM_BATCH __attribute__((annotate("cppmm|batch")))
+#define CPPMM_ASYNC __attribute__((annotate("cppmm|async")))
 
 #define CPPMM_ENUM_PREFIX(x) __attribute__((annotate("cppmm|enum_prefix|" #x)))
 #define CPPMM_ENUM_SUFFIX(x) __attribute__((annotate("cppmm|enum_suffix|" #x)))
 #define CPPMM_RUSTIFY_ENUM __attribute__((annotate("cppmm|rustify_enum")))
 
 #define CPPMM_COPY(NS, CLASS) CLASS(const NS::CLASS& rhs) CPPMM_RENAME(copy); NS::CLASS& operator=(const NS::CLASS& rhs);
-#define CPPMM_MOVE(NS, CLASS) CLASS(NS::CLASS&& rhs) CPPMM_IGNORE; NS::CLASS& operator=(NS::CLASS&& rhs) CPPMM_IGNORE;
+#define CPPMM_MOVE(NS, CLASS) CLASS(NS::CLASS&& rhs) CPPMM_RENAME(move); NS::CLASS& operator=(NS::CLASS&& rhs) CPPMM_RENAME(move_assign);
 #define CPPMM_ROFIVE(NS, CLASS) CPPMM_COPY(NS, CLASS) CPPMM_MOVE(NS, CLASS) ~CLASS();
 )#");
 
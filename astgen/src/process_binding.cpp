@@ -597,8 +597,8 @@ std::vector<NodePtr> process_methods(const CXXRecordDecl* crd, bool is_base,
         } else if (const auto* cmd = dyn_cast<CXXMethodDecl>(d)) {
             SPDLOG_DEBUG("CMD {}: {}", cmd->getQualifiedNameAsString(),
                          (void*)cmd);
-            if (is_base && cmd->isCopyAssignmentOperator() ||
-                cmd->isMoveAssignmentOperator()) {
+            if (is_base && (cmd->isCopyAssignmentOperator() ||
+                            cmd->isMoveAssignmentOperator())) {
                 continue;
             }
 
@@ -2,6 +2,8 @@
 // vfx-rs
 //------------------------------------------------------------------------------
 #pragma once
+#include <fmt/format.h>
+
 #include <cstdint>
 #include <map>
 #include <memory>
@@ -51,6 +53,7 @@ enum class NodeKind : uint32_t {
     Typedef,
     FunctionPointerTypedef,
     InfixOperatorExpr,
+    ForExpr,
     Sentinal, // A sentinal entry to keep track of how many there are
 };
 
@@ -65,16 +68,92 @@ enum class PointerKind : uint32_t {
 
 using NodeId = uint64_t;
 
+//------------------------------------------------------------------------------
+// Symbol
+//------------------------------------------------------------------------------
+/// A string interned in a global table. Equal strings always get the same
+/// 32-bit id, so comparing two symbols is a single integer compare, and every
+/// copy of a name costs 4 bytes rather than a std::string.
+///
+/// Names are read far more often than they are built, so a symbol converts to
+/// the std::string it stands for wherever one is expected.
+class Symbol {
+    uint32_t m_id = 0;
+
+    static uint32_t intern(const std::string& s);
+
+public:
+    /// The empty string
+    Symbol() = default;
+    explicit Symbol(const std::string& s) : m_id(intern(s)) {}
+
+    Symbol& operator=(const std::string& s) {
+        m_id = intern(s);
+        return *this;
+    }
+
+    uint32_t id() const { return m_id; }
+    const std::string& str() const;
+    operator const std::string&() const { return str(); }
+
+    bool empty() const { return m_id == 0; }
+    size_t size() const { return str().size(); }
+    const char* c_str() const { return str().c_str(); }
+
+    bool operator==(Symbol rhs) const { return m_id == rhs.m_id; }
+    bool operator!=(Symbol rhs) const { return m_id != rhs.m_id; }
+};
+
+inline bool operator==(Symbol lhs, const std::string& rhs) {
+    return lhs.str() == rhs;
+}
+inline bool operator==(const std::string& lhs, Symbol rhs) {
+    return lhs == rhs.str();
+}
+inline bool operator==(Symbol lhs, const char* rhs) { return lhs.str() == rhs; }
+inline bool operator!=(Symbol lhs, const std::string& rhs) {
+    return lhs.str() != rhs;
+}
+inline bool operator!=(const std::string& lhs, Symbol rhs) {
+    return lhs != rhs.str();
+}
+inline bool operator!=(Symbol lhs, const char* rhs) { return lhs.str() != rhs; }
+
+inline std::string operator+(const std::string& lhs, Symbol rhs) {
+    return lhs + rhs.str();
+}
+inline std::string operator+(Symbol lhs, const std::string& rhs) {
+    return lhs.str() + rhs;
+}
+inline std::string operator+(const char* lhs, Symbol rhs) {
+    return lhs + rhs.str();
+}
+inline std::string operator+(Symbol lhs, const char* rhs) {
+    return lhs.str() + rhs;
+}
+
+//------------------------------------------------------------------------------
+// The attributes that asttoc checks for, interned up front
+namespace attr {
+extern const Symbol ASYNC;
+extern const Symbol BATCH;
+extern const Symbol IGNORE;
+extern const Symbol OPAQUEBYTES;
+extern const Symbol POOLED;
+extern const Symbol RUSTIFY_ENUM;
+extern const Symbol VALUETYPE;
+} // namespace attr
+
 //------------------------------------------------------------------------------
 // Node
 //------------------------------------------------------------------------------
 struct Node {
-    std::string name;
+    Symbol name;
     NodeId id;
     NodeKind kind;
     bool private_;
 
-    Node(std::string name, NodeId id, NodeKind kind)
+    Node(const std::string& name, NodeId id, NodeKind kind)
         : name(name), id(id), kind(kind), private_(false) {}
 
     virtual ~Node() {}
@@ -96,6 +175,10 @@ struct TranslationUnit {
     std::set<std::string> private_includes;
     std::set<std::string> header_includes;
 
+    // The c and cpp type names of each record, paired up for cppmm::cast in
+    // the private header
+    std::vector<std::pair<std::string, std::string>> casts;
+
     std::vector<std::string> include_paths;
 
     using Self = TranslationUnit;
@@ -127,12 +210,13 @@ struct TranslationUnit {
 // NodeNamespace
 //------------------------------------------------------------------------------
 struct NodeNamespace : public Node {
-    std::string short_name;
-    std::string alias;
+    Symbol short_name;
+    Symbol alias;
     bool collapse;
 
-    NodeNamespace(std::string name, NodeId id, std::string short_name,
-                  std::string alias, bool collapse)
+    NodeNamespace(const std::string& name, NodeId id,
+                  const std::string& short_name, const std::string& alias,
+                  bool collapse)
         : Node(name, id, NodeKind::Namespace), short_name(short_name),
           alias(alias), collapse(collapse) {}
 
@@ -148,10 +232,10 @@ struct NodeNamespace : public Node {
 //------------------------------------------------------------------------------
 struct NodeType : public Node {
     bool const_;
-    std::string type_name;
+    Symbol type_name;
 
-    NodeType(std::string qualified_name, NodeId id, NodeKind node_kind,
-             std::string type_name, bool const_)
+    NodeType(const std::string& qualified_name, NodeId id, NodeKind node_kind,
+             const std::string& type_name, bool const_)
         : Node(qualified_name, id, node_kind), const_(const_),
           type_name(type_name) {}
 };
@@ -326,12 +410,12 @@ struct Param {
 // NodeAttributeHolder
 //------------------------------------------------------------------------------
 struct NodeAttributeHolder : public Node {
-    std::vector<std::string> attrs;
+    std::vector<Symbol> attrs;
     /// doc comment, decoded
     std::string comment;
 
     NodeAttributeHolder(std::string name, NodeId id, NodeKind node_kind,
-                        std::vector<std::string> attrs, std::string comment)
+                        std::vector<Symbol> attrs, std::string comment)
         : Node(name, id, node_kind), attrs(attrs), comment(std::move(comment)) {
     }
 };
@@ -459,6 +543,25 @@ struct NodeAssignExpr : public NodeExpr { // TODO LT: Added by luke
     }
 };
 
+//------------------------------------------------------------------------------
+// NodeForExpr
+//------------------------------------------------------------------------------
+struct NodeForExpr : public NodeExpr { // for (i = 0; i < count; ++i) {}
+    std::string index;
+    NodeExprPtr count;
+    NodeExprPtr body;
+
+    NodeForExpr(std::string index, NodeExprPtr count, NodeExprPtr body)
+        : NodeExpr(NodeKind::ForExpr), index(std::move(index)),
+          count(std::move(count)), body(std::move(body)) {}
+
+    // A static method for creating this as a shared pointer
+    using This = NodeForExpr;
+    template <typename... Args> static std::shared_ptr<This> n(Args&&... args) {
+        return std::make_shared<This>(std::forward<Args>(args)...);
+    }
+};
+
 //------------------------------------------------------------------------------
 // NodeRefExpr
 //------------------------------------------------------------------------------
@@ -615,6 +718,8 @@ struct NodeFunction : public NodeAttributeHolder {
     bool in_binding = false;
     bool in_library = false;
     bool inline_ = false;
+    // Index of the wrapper's call counters when built with --instrument
+    int stats_id = -1;
 
     NodeExprPtr body;
     std::vector<NodeId> namespaces;
@@ -622,7 +727,7 @@ struct NodeFunction : public NodeAttributeHolder {
     std::vector<Exception> exceptions;
 
     NodeFunction(std::string qualified_name, NodeId id,
-                 std::vector<std::string> attrs, std::string short_name,
+                 std::vector<Symbol> attrs, std::string short_name,
                  NodeTypePtr&& return_type, std::vector<Param>&& params,
                  std::string nice_name, std::string comment,
                  std::vector<NodeTypePtr>&& template_args,
@@ -649,13 +754,15 @@ struct NodeMethod : public NodeFunction {
     bool is_destructor;
     bool is_constructor;
     bool is_copy_constructor;
+    bool is_move_constructor;
     bool is_const;
 
     NodeMethod(std::string qualified_name, NodeId id,
-               std::vector<std::string> attrs, std::string short_name,
+               std::vector<Symbol> attrs, std::string short_name,
                NodeTypePtr&& return_type, std::vector<Param>&& params,
                bool is_static, bool is_constructor, bool is_copy_constructor,
-               bool is_destructor, bool is_const, std::string comment,
+               bool is_move_constructor, bool is_destructor, bool is_const,
+               std::string comment,
                std::vector<NodeTypePtr>&& template_args,
                std::vector<Exception> exceptions)
         : NodeFunction(qualified_name, id, attrs, short_name,
@@ -664,6 +771,7 @@ struct NodeMethod : public NodeFunction {
                        std::move(template_args), std::move(exceptions)),
           is_static(is_static), is_constructor(is_constructor),
           is_copy_constructor(is_copy_constructor),
+          is_move_constructor(is_move_constructor),
           is_destructor(is_destructor), is_const(is_const) {
         kind = NodeKind::Method;
     }
@@ -705,8 +813,22 @@ struct NodeRecord : public NodeAttributeHolder {
 
     std::string nice_name;
 
+    // Wrappers giving direct access to the storage of contiguous containers
+    // such as std::vector. Only set on c records.
+    NodePtr data_function;
+    NodePtr data_mut_function;
+    NodePtr size_function;
+    // Packs a container of strings into a single buffer
+    NodePtr string_table_function;
+    // The wrapper of the constructor taking no arguments, if any. Only set on
+    // c records.
+    NodePtr default_constructor;
+    // The public wrappers of the record's methods, in the order they are
+    // declared. Only set on c records.
+    std::vector<NodePtr> functions;
+
     NodeRecord(const TranslationUnit::Ptr& tu, std::string qualified_name,
-               NodeId id, std::vector<std::string> attrs, uint32_t size,
+               NodeId id, std::vector<Symbol> attrs, uint32_t size,
                uint32_t align, const std::string& alias,
                const std::vector<NodeId>& namespaces, bool abstract,
                bool trivially_copyable, bool trivially_movable,
@@ -741,7 +863,7 @@ struct NodeEnum : public NodeAttributeHolder {
 
     NodeEnum(const TranslationUnit::Ptr& tu, std::string qualified_name,
              std::string nice_name, std::string short_name, NodeId id,
-             std::vector<std::string> attrs,
+             std::vector<Symbol> attrs,
              std::vector<std::pair<std::string, std::string>> variants,
              uint32_t size, uint32_t align,
              const std::vector<NodeId>& namespaces, std::string comment)
@@ -767,7 +889,7 @@ struct NodeTypedef : public NodeAttributeHolder {
     NodeTypedef(const TranslationUnit::Ptr& tu, std::string qualified_name,
                 const NodeTypePtr& type, std::string comment)
         : NodeAttributeHolder(qualified_name, 0, NodeKind::Typedef,
-                              std::vector<std::string>(), std::move(comment)),
+                              std::vector<Symbol>(), std::move(comment)),
           tu(tu), type(type) {}
 
     using This = NodeTypedef;
@@ -796,7 +918,7 @@ struct NodeFunctionPointerTypedef : public NodeAttributeHolder {
                                std::vector<Param>&& params)
         : NodeAttributeHolder(qualified_name, id,
                               NodeKind::FunctionPointerTypedef,
-                              std::vector<std::string>(), std::move(comment)),
+                              std::vector<Symbol>(), std::move(comment)),
           tu(tu), alias(alias), namespaces(namespaces),
           return_type(std::move(return_type)), params(std::move(params)) {}
 
@@ -834,9 +956,9 @@ inline BindType bind_type(const NodeRecord& cpp_record) {
 
     if (cpp_record.trivially_movable && !cpp_record.opaque_type) {
         for (auto i : cpp_record.attrs) {
-            if (i == "cppmm|opaquebytes") {
+            if (i == attr::OPAQUEBYTES) {
                 return BindType::OpaqueBytes;
-            } else if (i == "cppmm|valuetype") {
+            } else if (i == attr::VALUETYPE) {
                 return BindType::ValueType;
             }
         }
@@ -845,4 +967,119 @@ inline BindType bind_type(const NodeRecord& cpp_record) {
     return bind_type;
 }
 
+//------------------------------------------------------------------------------
+// Whether instances of an opaqueptr record are allocated from the generated
+// pools (CPPMM_POOLED) rather than with new and delete
+inline bool is_pooled(const NodeRecord& record) {
+    if (bind_type(record) != BindType::OpaquePtr) {
+        return false;
+    }
+
+    for (const auto& i : record.attrs) {
+        if (i == attr::POOLED) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//------------------------------------------------------------------------------
+inline bool has_pooled_records(const Root& root, size_t starting_point) {
+    for (size_t i = starting_point; i < root.tus.size(); ++i) {
+        for (const auto& node : root.tus[i]->decls) {
+            if (node->kind == NodeKind::Record &&
+                is_pooled(*static_cast<const NodeRecord*>(node.get()))) {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+//------------------------------------------------------------------------------
+inline bool has_instrumented_functions(const Root& root,
+                                       size_t starting_point) {
+    for (size_t i = starting_point; i < root.tus.size(); ++i) {
+        for (const auto& node : root.tus[i]->decls) {
+            if (node->kind == NodeKind::Function &&
+                static_cast<const NodeFunction*>(node.get())->stats_id != -1) {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+//------------------------------------------------------------------------------
+// Whether any of the c functions are CPPMM_ASYNC, and so need the task pool
+inline bool has_async_functions(const Root& root, size_t starting_point) {
+    for (size_t i = starting_point; i < root.tus.size(); ++i) {
+        for (const auto& node : root.tus[i]->decls) {
+            if (node->kind != NodeKind::Function) {
+                continue;
+            }
+
+            const auto& fn = static_cast<const NodeFunction&>(*node);
+            for (const auto& a : fn.attrs) {
+                if (a == attr::ASYNC) {
+                    return true;
+                }
+            }
+        }
+    }
+
+    return false;
+}
+
+//------------------------------------------------------------------------------
+// The index of the void* parameter that a function pointer typedef passes its
+// user data through, or -1 if it has none. Trampolines are only generated for
+// callbacks taking and returning builtins, which need no conversion.
+inline int find_user_data_param(const NodeFunctionPointerTypedef& fpt) {
+    const auto is_builtin = [](const NodeTypePtr& t) {
+        if (t->kind == NodeKind::PointerType) {
+            const auto& p = static_cast<const NodePointerType&>(*t);
+            return p.pointer_kind == PointerKind::Pointer &&
+                   p.pointee_type->kind == NodeKind::BuiltinType;
+        }
+        return t->kind == NodeKind::BuiltinType;
+    };
+
+    if (!is_builtin(fpt.return_type)) {
+        return -1;
+    }
+
+    int result = -1;
+    for (size_t i = 0; i < fpt.params.size(); ++i) {
+        const auto& t = fpt.params[i].type;
+        if (!is_builtin(t)) {
+            return -1;
+        }
+
+        if (result == -1 && t->kind == NodeKind::PointerType) {
+            const auto& pointee =
+                *static_cast<const NodePointerType&>(*t).pointee_type;
+            if (pointee.type_name == "void" && !pointee.const_) {
+                result = static_cast<int>(i);
+            }
+        }
+    }
+
+    return result;
+}
+
 } // namespace cppmm
+
+//------------------------------------------------------------------------------
+// Symbols format as the string they stand for
+namespace fmt {
+template <> struct formatter<cppmm::Symbol> : formatter<string_view> {
+    template <typename FormatContext>
+    auto format(cppmm::Symbol s, FormatContext& ctx) -> decltype(ctx.out()) {
+        return formatter<string_view>::format(s.str(), ctx);
+    }
+};
+} // namespace fmt
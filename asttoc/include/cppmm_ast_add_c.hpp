@@ -8,7 +8,8 @@
 namespace cppmm {
 namespace transform {
 
-void add_c(const std::string& output_directory, Root& root);
+void add_c(const std::string& project_name,
+           const std::string& output_directory, Root& root);
 
 } // namespace transform
 } // namespace cppmm
@@ -9,8 +9,19 @@ namespace cppmm {
 class Root;
 
 namespace write {
-void c(const char* project_name, const Root& root, size_t starting_point);
+void c(const char* project_name, const Root& root, size_t starting_point,
+       const char* base_project_name, bool exceptions, bool split_headers);
 void cerrors(const char* output_dir, Root& root, size_t starting_point,
              const char* project_name);
+void cstringtable(const char* output_dir, Root& root, size_t starting_point,
+                  const char* project_name);
+void ccast(const char* output_dir, Root& root, size_t starting_point,
+           const char* project_name);
+void cpool(const char* output_dir, Root& root, size_t starting_point,
+           const char* project_name);
+void ctask(const char* output_dir, Root& root, size_t starting_point,
+           const char* project_name);
+void cstats(const char* output_dir, Root& root, size_t starting_point,
+            const char* project_name);
 } // namespace write
 } // namespace cppmm
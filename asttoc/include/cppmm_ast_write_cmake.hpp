@@ -15,6 +15,8 @@ using LibDirs = std::vector<std::string>;
 namespace write {
 void cmake(const char* project_name, const Root& root, size_t starting_point,
            const Libs& libs, const LibDirs& lib_dirs, int version_major,
-           int version_minor, int version_patch, const char* base_project_name);
+           int version_minor, int version_patch, const char* base_project_name,
+           bool static_lib, bool unity_build, int unity_batch_size,
+           bool precompile_headers, bool exceptions);
 } // namespace write
 } // namespace cppmm
@@ -15,6 +15,7 @@ void write(const char* out_dir, const char* project_name, const char* c_dir,
            const Root& root, size_t starting_point,
            const std::vector<std::string>& libs,
            const std::vector<std::string>& lib_dirs, int version_major,
-           int version_minor, int version_patch);
+           int version_minor, int version_patch, bool static_lib,
+           bool benches);
 } // namespace rust_sys
 } // namespace cppmm
@@ -1,7 +1,74 @@
 #include "cppmm_ast.hpp"
 
+#include <deque>
+#include <unordered_map>
+
 namespace cppmm {
 
 std::map<unsigned int, std::string> EXCEPTION_MAP;
 
+namespace {
+//------------------------------------------------------------------------------
+// The strings live in a deque so that they never move, which lets the index
+// be keyed on pointers to them rather than on copies.
+struct SymbolTable {
+    struct Hash {
+        size_t operator()(const std::string* s) const {
+            return std::hash<std::string>()(*s);
+        }
+    };
+
+    struct Equal {
+        bool operator()(const std::string* a, const std::string* b) const {
+            return *a == *b;
+        }
+    };
+
+    std::deque<std::string> strings;
+    std::unordered_map<const std::string*, uint32_t, Hash, Equal> ids;
+
+    SymbolTable() {
+        // Id 0 is the empty string, which is what Symbol() refers to
+        strings.emplace_back();
+        ids.emplace(&strings.back(), 0);
+    }
+};
+
+// Constructed on first use, since the attr:: symbols below are interned during
+// static initialization
+SymbolTable& symbol_table() {
+    static SymbolTable table;
+    return table;
 }
+} // namespace
+
+//------------------------------------------------------------------------------
+// FIXME: this isn't thread safe, but nothing reads the AST on more than one
+// thread
+uint32_t Symbol::intern(const std::string& s) {
+    auto& table = symbol_table();
+    auto it = table.ids.find(&s);
+    if (it != table.ids.end()) {
+        return it->second;
+    }
+
+    const auto id = static_cast<uint32_t>(table.strings.size());
+    table.strings.push_back(s);
+    table.ids.emplace(&table.strings.back(), id);
+    return id;
+}
+
+//------------------------------------------------------------------------------
+const std::string& Symbol::str() const { return symbol_table().strings[m_id]; }
+
+namespace attr {
+const Symbol ASYNC("cppmm|async");
+const Symbol BATCH("cppmm|batch");
+const Symbol IGNORE("cppmm|ignore");
+const Symbol OPAQUEBYTES("cppmm|opaquebytes");
+const Symbol POOLED("cppmm|pooled");
+const Symbol RUSTIFY_ENUM("cppmm|rustify_enum");
+const Symbol VALUETYPE("cppmm|valuetype");
+} // namespace attr
+
+} // namespace cppmm
@@ -3,6 +3,7 @@
 //------------------------------------------------------------------------------
 #include "cppmm_ast_add_c.hpp"
 #include "cppmm_ast.hpp"
+#include "cppmm_naming.hpp"
 #include "pystring.h"
 #include <iostream>
 #include <unordered_map>
@@ -35,107 +36,201 @@ static const char* THIS_ = "this_";
 // TypeRegistry
 //------------------------------------------------------------------------------
 class TypeRegistry {
-    struct Records {
+    // Everything registered against a cpp node id
+    struct Entry {
         NodePtr m_cpp;
         NodePtr m_c;
+
+        // Namespaces and records both scope the names inside them
+        bool m_has_namespace = false;
+        std::string m_namespace;
+        bool m_has_namespace_alias = false;
+        std::string m_namespace_alias;
+        bool m_collapse = false;
     };
 
-    // The node entries are sparse, so store them in a map for the moment.
-    using Mapping = std::unordered_map<NodeId, Records>;
-    using Namespaces = std::unordered_map<NodeId, std::string>;
-    using NamespaceAliases =
-        std::unordered_map<NodeId, std::pair<std::string, bool>>;
+    // astgen hands out ids sequentially from zero, so the entries are stored
+    // densely and every lookup is an index into the vector
+    using Entries = std::vector<Entry>;
     using SymbolCounts = std::unordered_map<std::string, size_t>;
 
-    Mapping m_mapping;
-    Namespaces m_namespaces;
-    NamespaceAliases m_namespace_aliases;
+    Entries m_entries;
     SymbolCounts m_symbol_counts;
 
+    // Every overload of a function asks for the same qualified names again, so
+    // they are memoized on the namespace path and alias. This relies on each
+    // namespace being registered once, before anything inside it is named.
+    naming::NameCache m_qualified_names;
+    naming::NameCache m_qualified_nice_names;
+    std::string m_name_key;
+
+    Entry& entry(NodeId id) {
+        if (id >= m_entries.size()) {
+            m_entries.resize(id + 1);
+        }
+        return m_entries[id];
+    }
+
+    const Entry* find(NodeId id) const {
+        return id < m_entries.size() ? &m_entries[id] : nullptr;
+    }
+
+    // The cpp or c node registered for id, or a null pointer if there is none.
+    // The cpp node must be of the given kind.
+    const NodePtr& find_node(NodeId id, NodeKind kind, bool c,
+                             const char* accessor) const {
+        static const NodePtr none;
+
+        const auto* e = find(id);
+        if (!e || !e->m_cpp) {
+            return none;
+        }
+
+        expect(e->m_cpp->kind == kind, "Incorrect return type ({}) for {}",
+               e->m_cpp->kind, accessor);
+        return c ? e->m_c : e->m_cpp;
+    }
+
+    // Pack the namespace path and alias into m_name_key for the name caches
+    naming::StringRef name_key(const std::vector<NodeId>& namespaces,
+                               const std::string& alias) {
+        const auto count = namespaces.size();
+        m_name_key.clear();
+        m_name_key.append(reinterpret_cast<const char*>(&count), sizeof(count));
+        m_name_key.append(reinterpret_cast<const char*>(namespaces.data()),
+                          count * sizeof(NodeId));
+        m_name_key += alias;
+        return m_name_key;
+    }
+
 public:
+    // Reserve room for ids up to and including id
+    void reserve(NodeId id) { m_entries.reserve(id + 1); }
+
     void add(NodeId id, NodePtr cpp, NodePtr c) {
         // TODO LT: Assert for double entries
         // TODO LT: Assert for RecordKind/EnumKind in cpp and c
-        m_mapping.insert(
-            std::make_pair(id, Records{std::move(cpp), std::move(c)}));
+        auto& e = entry(id);
+        e.m_cpp = std::move(cpp);
+        e.m_c = std::move(c);
     }
 
     void add_namespace(NodeId id, const std::string& ns) {
         // TODO LT: Assert for double entries
-        m_namespaces[id] = ns;
+        auto& e = entry(id);
+        e.m_has_namespace = true;
+        e.m_namespace = ns;
     }
 
     void add_namespace_alias(NodeId id, const std::string& ns, bool collapse) {
         // TODO LT: Assert for double entries
-        m_namespace_aliases[id] = std::make_pair(ns, collapse);
+        auto& e = entry(id);
+        e.m_has_namespace_alias = true;
+        e.m_namespace_alias = ns;
+        e.m_collapse = collapse;
     }
 
     const char* find_namespace(NodeId id) const {
-        auto result = m_namespaces.find(id);
-        if (result == m_namespaces.end()) {
+        const auto* e = find(id);
+        if (!e || !e->m_has_namespace) {
             SPDLOG_ERROR("Could not find namespace for id {}", id);
             return ""; // TODO LT: optional return with error would be better
         } else {
-            return result->second.c_str();
+            return e->m_namespace.c_str();
         }
     }
 
-    std::pair<std::string, bool> find_namespace_alias(NodeId id) const {
-        auto result = m_namespace_aliases.find(id);
-        if (result == m_namespace_aliases.end()) {
+    std::pair<const char*, bool> find_namespace_alias(NodeId id) const {
+        const auto* e = find(id);
+        if (!e || !e->m_has_namespace_alias) {
             SPDLOG_ERROR("Could not find namespace for id {}", id);
             return std::make_pair("", false);
         } else {
-            return result->second;
+            return std::make_pair(e->m_namespace_alias.c_str(), e->m_collapse);
         }
     }
 
     NodeRecord& edit_c(NodeId id) {
-        auto& node =
-            m_mapping[id].m_c; // TODO LT: Check existance + return optional
-        // TODO LT: Assert kind is record
+        const auto& node = find_node(id, NodeKind::Record, true, "edit_c");
+        expect(node, "Could not find c record for id {}", id);
 
         return static_cast<NodeRecord&>(*node);
     }
 
-    NodePtr find_enum_c(NodeId id) const {
-        auto entry = m_mapping.find(id);
+    // The lookups below return a null pointer when nothing is registered for
+    // the id. Where the caller needs the node itself rather than the shared
+    // pointer, the typed variants save the cast.
+    const NodePtr& find_enum_c(NodeId id) const {
+        return find_node(id, NodeKind::Enum, true, "find_enum_c");
+    }
+
+    const NodePtr& find_enum_cpp(NodeId id) const {
+        return find_node(id, NodeKind::Enum, false, "find_enum_cpp");
+    }
 
-        if (entry == m_mapping.end()) {
-            return NodePtr(); // TODO LT: Turn this into optional
-        } else {
-            expect(entry->second.m_cpp->kind == NodeKind::Enum,
-                   "Incorrect return type ({}) for find_enum_c",
-                   entry->second.m_cpp->kind);
-            return entry->second.m_c;
-        }
+    const NodePtr& find_record_c(NodeId id) const {
+        return find_node(id, NodeKind::Record, true, "find_record_c");
     }
 
-    NodePtr find_record_c(NodeId id) const {
-        auto entry = m_mapping.find(id);
+    const NodeRecord* record_c(NodeId id) const {
+        return static_cast<const NodeRecord*>(find_record_c(id).get());
+    }
 
-        if (entry == m_mapping.end()) {
-            return NodePtr(); // TODO LT: Turn this into optional
-        } else {
-            expect(entry->second.m_cpp->kind == NodeKind::Record,
-                   "Incorrect return type ({}) for find_record_c",
-                   entry->second.m_cpp->kind);
-            return entry->second.m_c;
-        }
+    const NodePtr& find_record_cpp(NodeId id) const {
+        return find_node(id, NodeKind::Record, false, "find_record_cpp");
     }
 
-    NodePtr find_function_pointer_typedef_c(NodeId id) const {
-        auto entry = m_mapping.find(id);
+    const NodeRecord* record_cpp(NodeId id) const {
+        return static_cast<const NodeRecord*>(find_record_cpp(id).get());
+    }
 
-        if (entry == m_mapping.end()) {
-            return NodePtr(); // TODO LT: Turn this into optional
-        } else {
-            expect(entry->second.m_cpp->kind ==
-                       NodeKind::FunctionPointerTypedef,
-                   "Incorrect return type ({}) for find_record_c",
-                   entry->second.m_cpp->kind);
-            return entry->second.m_c;
+    const NodeRecord* record_cpp_by_name(const std::string& name) const {
+        for (const auto& e : m_entries) {
+            const auto& cpp = e.m_cpp;
+            if (cpp && cpp->kind == NodeKind::Record && cpp->name == name) {
+                return static_cast<const NodeRecord*>(cpp.get());
+            }
         }
+
+        return nullptr;
+    }
+
+    const NodePtr& find_function_pointer_typedef_c(NodeId id) const {
+        return find_node(id, NodeKind::FunctionPointerTypedef, true,
+                         "find_function_pointer_typedef_c");
+    }
+
+    // The name of alias inside the namespaces, joined with '_'
+    const std::string& qualified_name(const std::vector<NodeId>& namespaces,
+                                      const std::string& alias) {
+        const auto key = name_key(namespaces, alias);
+        return m_qualified_names.get(key, [&](std::string& out) {
+            for (const auto& ns : namespaces) {
+                naming::append_replaced(find_namespace(ns), '-', "neg", out);
+                out += '_';
+            }
+            naming::append_replaced(alias, '-', "neg", out);
+        });
+    }
+
+    // As qualified_name, but using the namespace aliases
+    const std::string&
+    qualified_nice_name(const std::vector<NodeId>& namespaces,
+                        const std::string& alias) {
+        const auto key = name_key(namespaces, alias);
+        return m_qualified_nice_names.get(key, [&](std::string& out) {
+            for (const auto& ns : namespaces) {
+                auto p = find_namespace_alias(ns);
+                if (p.second) {
+                    // we want to collapse the head of the namespace path
+                    // into this single alias
+                    out.clear();
+                }
+                naming::append_replaced(p.first, '-', "neg", out);
+                out += '_';
+            }
+            naming::append_replaced(alias, '-', "neg", out);
+        });
     }
 
     std::string make_symbol_unique(const std::string& symbol) {
@@ -158,7 +253,6 @@ public:
 namespace generate {
 
 const NodeId PLACEHOLDER_ID = 0;
-const char* IGNORE = "cppmm|ignore";
 
 //------------------------------------------------------------------------------
 std::tuple<std::string, std::string, std::string>
@@ -177,143 +271,6 @@ compute_c_filepath(const std::string& outdir, const std::string& cpp_filepath) {
     };
 }
 
-//------------------------------------------------------------------------------
-std::string remap_special_methods(const std::string& name) {
-    if (name.empty()) {
-        return "";
-    }
-
-    // Destructor
-    if (name[0] == '~') {
-        return std::string("dtor");
-    }
-
-    // Operators
-    if (name == "operator=") {
-        return std::string("_assign");
-    }
-    if (name == "operator==") {
-        return std::string("_eq");
-    }
-    if (name == "operator!=") {
-        return std::string("_ne");
-    }
-    if (name == "operator++") {
-        return std::string("_op_inc");
-    }
-    if (name == "operator--") {
-        return std::string("_op_dec");
-    }
-    if (name == "operator+") {
-        return std::string("_op_add");
-    }
-    if (name == "operator-") {
-        return std::string("_op_sub");
-    }
-    if (name == "operator/") {
-        return std::string("_op_div");
-    }
-    if (name == "operator*") {
-        return std::string("_op_mul");
-    }
-    if (name == "operator^") {
-        return std::string("_op_xor");
-    }
-    if (name == "operator%") {
-        return std::string("_op_mod");
-    }
-    if (name == "operator[]") {
-        return std::string("_index");
-    }
-    if (name == "operator+=") {
-        return std::string("_op_iadd");
-    }
-    if (name == "operator-=") {
-        return std::string("_op_isub");
-    }
-    if (name == "operator/=") {
-        return std::string("_op_idiv");
-    }
-    if (name == "operator*=") {
-        return std::string("_op_imul");
-    }
-    if (name == "operator%=") {
-        return std::string("_op_imod");
-    }
-    if (name == "operator^=") {
-        return std::string("_op_ixor");
-    }
-    if (name == "operator()") {
-        return std::string("_op_call");
-    }
-
-    // Just use the input name
-    return name;
-}
-
-//------------------------------------------------------------------------------
-std::string compute_c_name(const std::string& name) {
-    std::string result;
-    for (auto const& c : remap_special_methods(name)) {
-        switch (c) {
-        case ':':
-        case ',':
-        case '*':
-        case '<':
-        case '>':
-        case '-':
-            result.push_back('_');
-            break;
-        case ' ':
-            break;
-        default:
-            result.push_back(c);
-        }
-    }
-    return result;
-}
-
-//------------------------------------------------------------------------------
-std::string compute_qualified_name(const TypeRegistry& type_registry,
-                                   const std::vector<NodeId>& namespaces,
-                                   const std::string& alias) {
-    std::string result;
-    for (const auto& ns : namespaces) {
-        result += type_registry.find_namespace(ns);
-        result += "_";
-    }
-
-    result += alias;
-
-    result = pystring::replace(result, "-", "neg");
-
-    return result;
-}
-
-//------------------------------------------------------------------------------
-std::string compute_qualified_nice_name(const TypeRegistry& type_registry,
-                                        const std::vector<NodeId>& namespaces,
-                                        const std::string& alias) {
-    std::string result;
-    for (const auto& ns : namespaces) {
-        auto p = type_registry.find_namespace_alias(ns);
-        if (p.second) {
-            // we want to collapse the head of the namespace path
-            // into this single alias
-            result = p.first + "_";
-        } else {
-            result += p.first;
-            result += "_";
-        }
-    }
-
-    result += alias;
-
-    result = pystring::replace(result, "-", "neg");
-
-    return result;
-}
-
 struct ConvertType {
     NodeTypePtr type;
     bool is_opaqueptr;
@@ -329,6 +286,8 @@ ConvertType convert_builtin_type(TranslationUnit& c_tu,
     // TODO LT: Do mapping of c++ builtins to c builtins
     if (t->type_name == "_Bool") {
         c_tu.header_includes.insert("#include <stdbool.h>");
+    } else if (t->type_name == "size_t") {
+        c_tu.header_includes.insert("#include <stddef.h>");
     }
 
     // For now just copy everything one to one.
@@ -337,22 +296,20 @@ ConvertType convert_builtin_type(TranslationUnit& c_tu,
 }
 
 //------------------------------------------------------------------------------
-std::string build_enum_to_cpp_name(const TypeRegistry& type_registry,
-                                   const NodeTypePtr& t, const char* suffix) {
-    expect(suffix[0] != '\0', "Suffix must not be empty");
-
+// Every enum has the same integer c type, so unlike the records their casts
+// can't be found from the c type alone and are named explicitly instead
+std::string build_enum_cast_name(const TypeRegistry& type_registry,
+                                 const NodeTypePtr& t, const char* function) {
     const auto& cpp_enum_type = *static_cast<const NodeEnumType*>(t.get());
-    const auto& node_ptr = type_registry.find_enum_c(cpp_enum_type.enm);
-    if (!node_ptr) {
+    const auto& c_enum = type_registry.find_enum_c(cpp_enum_type.enm);
+    const auto& cpp_enum = type_registry.find_enum_cpp(cpp_enum_type.enm);
+    if (!c_enum || !cpp_enum) {
         SPDLOG_ERROR("Found unsupported type: {}", t->type_name);
         return std::string();
     }
 
-    std::string result = node_ptr->name;
-    result += "_";
-    result += suffix;
-
-    return result;
+    return fmt::format("cppmm::cast<{}, {}>::{}", c_enum->name, cpp_enum->name,
+                       function);
 }
 
 //------------------------------------------------------------------------------
@@ -571,12 +528,33 @@ bool parameter(TranslationUnit& c_tu, TypeRegistry& type_registry,
         return false;
     }
 
+    // Rvalue references are passed as pointers and std::move'd into the call
+    if (param.type->kind == NodeKind::PointerType &&
+        static_cast<const NodePointerType*>(param.type.get())->pointer_kind ==
+            PointerKind::RValueReference) {
+        c_tu.source_includes.insert("#include <utility>");
+    }
+
     params.push_back(
         Param(std::string(param.name), std::move(param_type), params.size()));
 
     return true;
 }
 
+//------------------------------------------------------------------------------
+// Functions returning an rvalue reference hand the object over to the caller,
+// so wrap them as returning it by value, which moves it into the result.
+const NodeTypePtr& return_value_type(const NodeTypePtr& t) {
+    if (t->kind == NodeKind::PointerType) {
+        const auto* p = static_cast<const NodePointerType*>(t.get());
+        if (p->pointer_kind == PointerKind::RValueReference) {
+            return p->pointee_type;
+        }
+    }
+
+    return t;
+}
+
 //------------------------------------------------------------------------------
 void opaquebytes_record(NodeRecord& c_record) {
     constexpr auto sizeof_byte = 8;
@@ -632,7 +610,7 @@ NodeExprPtr this_reference(const NodeRecord& cpp_record, bool const_) {
 bool should_wrap_function(const NodeFunction& cpp_function) {
     // Check its not ignored
     for (const auto& a : cpp_function.attrs) {
-        if (a == IGNORE) {
+        if (a == attr::IGNORE) {
             return false;
         }
     }
@@ -673,7 +651,7 @@ NodeExprPtr convert_record_to(const TypeRegistry& type_registry,
 //------------------------------------------------------------------------------
 NodeExprPtr convert_enum_to(const TypeRegistry& type_registry,
                             const NodeTypePtr& t, const NodeExprPtr& name) {
-    const auto to_cpp = build_enum_to_cpp_name(type_registry, t, "to_cpp_ref");
+    const auto to_cpp = build_enum_cast_name(type_registry, t, "to_cpp_ref");
 
     auto reference = NodeRefExpr::n(NodeExprPtr(name));
     return NodeFunctionCallExpr::n(to_cpp,
@@ -730,7 +708,7 @@ std::string compute_to_cpp_name(const TypeRegistry& type_registry,
     case NodeKind::RecordType:
         return std::string(suffix);
     case NodeKind::EnumType:
-        return build_enum_to_cpp_name(type_registry, p->pointee_type, suffix);
+        return build_enum_cast_name(type_registry, p->pointee_type, suffix);
     default:
         panic("compute_to_cpp_name unhandled pointee kind {}",
               p->pointee_type->kind); // TODO LT: Clean this up
@@ -756,7 +734,7 @@ std::string compute_to_cpp_name(const TypeRegistry& type_registry,
     case NodeKind::RecordType:
         return std::string(suffix);
     case NodeKind::EnumType:
-        return build_enum_to_cpp_name(type_registry, node, suffix);
+        return build_enum_cast_name(type_registry, node, suffix);
     default:
         panic("unhandled node kind {}", node->kind); // TODO LT: Clean this up
         break;
@@ -778,8 +756,12 @@ NodeExprPtr convert_pointer_to(const TypeRegistry& type_registry,
         case PointerKind::Pointer: {
             return name;
         }
-        case PointerKind::RValueReference: // TODO LT: Add support for rvalue
-                                           // reference
+        case PointerKind::RValueReference: {
+            return NodeFunctionCallExpr::n(
+                "std::move",
+                std::vector<NodeExprPtr>({NodeDerefExpr::n(NodeExprPtr(name))}),
+                std::vector<NodeTypePtr>{});
+        }
         case PointerKind::Reference: {
             return NodeDerefExpr::n(NodeExprPtr(name));
         }
@@ -794,16 +776,25 @@ NodeExprPtr convert_pointer_to(const TypeRegistry& type_registry,
     case PointerKind::Pointer:
         to_cpp = compute_to_cpp_name(type_registry, p->pointee_type, "to_cpp");
         break;
-    case PointerKind::RValueReference: // TODO LT: Add support for rvalue
-                                       // reference
+    case PointerKind::RValueReference:
     case PointerKind::Reference:
         to_cpp =
             compute_to_cpp_name(type_registry, p->pointee_type, "to_cpp_ref");
         break;
     }
 
-    return NodeFunctionCallExpr::n(to_cpp, std::vector<NodeExprPtr>({name}),
-                                   std::vector<NodeTypePtr>{});
+    auto result = NodeFunctionCallExpr::n(
+        to_cpp, std::vector<NodeExprPtr>({name}), std::vector<NodeTypePtr>{});
+
+    // The object passed for an rvalue reference is consumed by the call, and
+    // left in a valid but unspecified state
+    if (p->pointer_kind == PointerKind::RValueReference) {
+        return NodeFunctionCallExpr::n("std::move",
+                                       std::vector<NodeExprPtr>({result}),
+                                       std::vector<NodeTypePtr>{});
+    }
+
+    return result;
 }
 
 //------------------------------------------------------------------------------
@@ -892,7 +883,8 @@ NodeExprPtr convert_return_record(const NodeTypePtr& from_ptr,
 }
 
 //------------------------------------------------------------------------------
-NodeExprPtr convert_return_pointer(const NodeTypePtr& from_ptr,
+NodeExprPtr convert_return_pointer(const TypeRegistry& type_registry,
+                                   const NodeTypePtr& from_ptr,
                                    const NodeTypePtr& to_ptr,
                                    const NodeExprPtr& rhs,
                                    const NodeExprPtr& lhs) {
@@ -918,12 +910,17 @@ NodeExprPtr convert_return_pointer(const NodeTypePtr& from_ptr,
         }
     }
 
+    std::string to_c = "to_c";
+    if (from->pointee_type->kind == NodeKind::EnumType) {
+        to_c = build_enum_cast_name(type_registry, from->pointee_type, "to_c");
+    }
+
     switch (from->pointer_kind) {
     case PointerKind::RValueReference: // TODO LT: Add support for rvalue
                                        // reference
     case PointerKind::Pointer:
     case PointerKind::Reference: {
-        return NodeFunctionCallExpr::n("to_c",
+        return NodeFunctionCallExpr::n(to_c,
                                        std::vector<NodeExprPtr>({lhs, rhs}),
                                        std::vector<NodeTypePtr>{});
     }
@@ -936,7 +933,8 @@ NodeExprPtr convert_return_pointer(const NodeTypePtr& from_ptr,
 }
 
 //------------------------------------------------------------------------------
-NodeExprPtr convert_return(const NodeTypePtr& from, const NodeTypePtr& to,
+NodeExprPtr convert_return(const TypeRegistry& type_registry,
+                           const NodeTypePtr& from, const NodeTypePtr& to,
                            const NodeExprPtr& rhs, const NodeExprPtr& lhs) {
     switch (to->kind) {
     case NodeKind::BuiltinType:
@@ -944,7 +942,7 @@ NodeExprPtr convert_return(const NodeTypePtr& from, const NodeTypePtr& to,
     case NodeKind::RecordType:
         return convert_return_record(from, to, rhs, lhs);
     case NodeKind::PointerType:
-        return convert_return_pointer(from, to, rhs, lhs);
+        return convert_return_pointer(type_registry, from, to, rhs, lhs);
     default:
         break;
     }
@@ -1003,10 +1001,19 @@ NodeExprPtr opaqueptr_constructor_body(TypeRegistry& type_registry,
     // included
     c_tu.source_includes.insert("#include <new>");
 
-    // Build the expression to alloc
+    // Build the expression to alloc. Pooled records come from their type's
+    // free list instead of the global allocator.
     auto lhs = NodeVarRefExpr::n("this_");
-    auto rhs = NodeNewExpr::n(NodeFunctionCallExpr::n(
-        cpp_record.name, args, std::vector<NodeTypePtr>{}));
+    NodeExprPtr rhs;
+    if (is_pooled(cpp_record)) {
+        rhs = NodeFunctionCallExpr::n(
+            "tlg_pool_new", args,
+            std::vector<NodeTypePtr>({NodeRecordType::n(
+                "", 0, cpp_record.name, cpp_record.id, false)}));
+    } else {
+        rhs = NodeNewExpr::n(NodeFunctionCallExpr::n(
+            cpp_record.name, args, std::vector<NodeTypePtr>{}));
+    }
 
     auto to_c =
         NodeFunctionCallExpr::n("to_c", std::vector<NodeExprPtr>({lhs, rhs}),
@@ -1041,11 +1048,24 @@ NodeExprPtr opaqueptr_destructor_body(TypeRegistry& type_registry,
                                       const NodeRecord& cpp_record,
                                       const NodeRecord& c_record,
                                       const NodeMethod& cpp_method) {
+    auto this_ = NodeFunctionCallExpr::n(
+        "to_cpp", std::vector<NodeExprPtr>{NodeVarRefExpr::n("this_")},
+        std::vector<NodeTypePtr>{});
+
+    // Pooled records hand their memory back to the pool (or leave it in their
+    // arena) instead of deleting it
+    if (is_pooled(cpp_record)) {
+        return NodeBlockExpr::n(std::vector<NodeExprPtr>({
+            NodeFunctionCallExpr::n("tlg_pool_delete",
+                                    std::vector<NodeExprPtr>{this_},
+                                    std::vector<NodeTypePtr>{}),
+            NodeReturnExpr::n(NodeVarRefExpr::n("0")),
+        }));
+    }
+
     // Create the method call expression
     return NodeBlockExpr::n(std::vector<NodeExprPtr>({
-        NodeDeleteExpr::n(NodeFunctionCallExpr::n(
-            "to_cpp", std::vector<NodeExprPtr>{NodeVarRefExpr::n("this_")},
-            std::vector<NodeTypePtr>{})),
+        NodeDeleteExpr::n(std::move(this_)),
         NodeReturnExpr::n(NodeVarRefExpr::n("0")),
     }));
 }
@@ -1081,8 +1101,8 @@ NodeExprPtr function_body(TypeRegistry& type_registry, TranslationUnit& c_tu,
         }
 
         return NodeBlockExpr::n(std::vector<NodeExprPtr>(
-            {convert_return(cpp_function.return_type, c_return, function_call,
-                            NodeVarRefExpr::n("return_")),
+            {convert_return(type_registry, cpp_function.return_type, c_return,
+                            function_call, NodeVarRefExpr::n("return_")),
              NodeReturnExpr::n(NodeVarRefExpr::n("0"))}));
     } else {
         auto function_call = NodeFunctionCallExpr::n(
@@ -1099,8 +1119,8 @@ NodeExprPtr function_body(TypeRegistry& type_registry, TranslationUnit& c_tu,
         }
 
         return NodeBlockExpr::n(std::vector<NodeExprPtr>(
-            {convert_return(cpp_function.return_type, c_return, function_call,
-                            NodeVarRefExpr::n("return_")),
+            {convert_return(type_registry, cpp_function.return_type, c_return,
+                            function_call, NodeVarRefExpr::n("return_")),
              NodeReturnExpr::n(NodeVarRefExpr::n("0"))}));
     }
 }
@@ -1145,8 +1165,8 @@ NodeExprPtr method_body(TypeRegistry& type_registry, TranslationUnit& c_tu,
     }
 
     return NodeBlockExpr::n(std::vector<NodeExprPtr>(
-        {convert_return(cpp_method.return_type, c_return, method_call,
-                        NodeVarRefExpr::n("return_")),
+        {convert_return(type_registry, cpp_method.return_type, c_return,
+                        method_call, NodeVarRefExpr::n("return_")),
          NodeReturnExpr::n(NodeVarRefExpr::n("0"))}));
 }
 
@@ -1187,9 +1207,9 @@ record_method_body(TypeRegistry& type_registry, TranslationUnit& c_tu,
 //------------------------------------------------------------------------------
 std::string find_function_short_name(const NodeFunction& cpp_function) {
     auto prefix = std::string("cppmm|rename|");
-    for (auto& a : cpp_function.attrs) {
-        if (pystring::startswith(a, prefix)) {
-            auto short_name = pystring::slice(a, prefix.size());
+    for (const auto& a : cpp_function.attrs) {
+        if (pystring::startswith(a.str(), prefix)) {
+            auto short_name = pystring::slice(a.str(), prefix.size());
             return short_name;
         }
     }
@@ -1222,7 +1242,7 @@ FunctionNames compute_function_names(TypeRegistry& type_registry,
     // that share a common suffix but with different prefixes
     // The full prefix we get by stripping the "_t" from the struct name
     std::string function_prefix = pystring::slice(c_record.name, 0, -2);
-    std::string function_suffix = compute_c_name(short_name);
+    std::string function_suffix = naming::to_c_name(short_name);
     std::string function_name = function_prefix + "_" + function_suffix;
     function_name = type_registry.make_symbol_unique(function_name);
 
@@ -1235,10 +1255,212 @@ FunctionNames compute_function_names(TypeRegistry& type_registry,
     return FunctionNames{function_name, function_nice_name};
 }
 
+//------------------------------------------------------------------------------
+// Sizes and counts are size_t, which comes out as usize in rust
+NodeTypePtr size_type() {
+    return NodeBuiltinType::n("size_t", 0, "size_t", false);
+}
+
+//------------------------------------------------------------------------------
+NodeTypePtr void_type() {
+    return NodeBuiltinType::n("void", 0, "void", false);
+}
+
+//------------------------------------------------------------------------------
+bool is_batch(const NodeFunction& cpp_function) {
+    return std::find(cpp_function.attrs.begin(), cpp_function.attrs.end(),
+                     attr::BATCH) != cpp_function.attrs.end();
+}
+
+//------------------------------------------------------------------------------
+// Whether a type can be laid out in a C array, i.e. a builtin, an enum or a
+// record stored by value
+bool is_batch_element(const TypeRegistry& type_registry, const NodeTypePtr& t) {
+    switch (t->kind) {
+    case NodeKind::BuiltinType:
+        return static_cast<const NodeBuiltinType*>(t.get())->type_name !=
+               "void";
+    case NodeKind::EnumType:
+        return true;
+    case NodeKind::RecordType: {
+        const auto* record = type_registry.record_cpp(
+            static_cast<const NodeRecordType*>(t.get())->record);
+        return record && bind_type(*record) != BindType::OpaquePtr;
+    }
+    default:
+        return false;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Add the parameter of a batch function for the cpp parameter, and the
+// expression for its i'th element. Values are passed as arrays of values, and
+// references as arrays of the referenced type.
+bool batch_parameter(TranslationUnit& c_tu, TypeRegistry& type_registry,
+                     std::vector<Param>& params, const Param& param,
+                     NodeExprPtr& element) {
+    const auto& t = param.type;
+    auto index = NodeVarRefExpr::n("i");
+
+    NodeTypePtr c_type;
+    if (t->kind == NodeKind::PointerType) {
+        const auto* p = static_cast<const NodePointerType*>(t.get());
+        if (p->pointer_kind != PointerKind::Reference ||
+            !is_batch_element(type_registry, p->pointee_type)) {
+            return false;
+        }
+
+        c_type = convert_type(c_tu, type_registry, t).type;
+        element = NodeInfixOperatorExpr::n(
+            "+",
+            std::vector<NodeExprPtr>({NodeVarRefExpr::n(param.name), index}),
+            std::vector<NodeTypePtr>{});
+    } else {
+        if (!is_batch_element(type_registry, t)) {
+            return false;
+        }
+
+        auto value_type = convert_type(c_tu, type_registry, t).type;
+        if (!value_type) {
+            return false;
+        }
+        value_type->const_ = true;
+        c_type = NodePointerType::n(PointerKind::Pointer, std::move(value_type),
+                                    false);
+        element = NodeDerefExpr::n(NodeInfixOperatorExpr::n(
+            "+",
+            std::vector<NodeExprPtr>({NodeVarRefExpr::n(param.name), index}),
+            std::vector<NodeTypePtr>{}));
+    }
+
+    if (!c_type) {
+        return false;
+    }
+
+    params.push_back(Param(std::string(param.name), std::move(c_type),
+                           params.size()));
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Add a <method>_batch(this_, params..., n, out) function for a method marked
+// CPPMM_BATCH, which calls the method on each of n contiguous records, taking
+// the i'th element of each parameter array and writing the i'th result to
+// out. The loop stays on the C++ side where the compiler can inline the method
+// and vectorize it.
+void batch_method(TypeRegistry& type_registry, TranslationUnit& c_tu,
+                  const NodeRecord& cpp_record, const NodeRecord& c_record,
+                  const NodeMethod& cpp_method,
+                  const NodeFunction& c_function) {
+    if (cpp_method.is_constructor || cpp_method.is_destructor ||
+        cpp_method.is_static) {
+        SPDLOG_WARN("Ignoring CPPMM_BATCH on {}, only non-static methods can "
+                    "be batched",
+                    cpp_method.name);
+        return;
+    }
+
+    if (bind_type(cpp_record) == BindType::OpaquePtr) {
+        SPDLOG_WARN("Ignoring CPPMM_BATCH on {}, opaqueptr records cannot be "
+                    "batched",
+                    cpp_method.name);
+        return;
+    }
+
+    const auto& cpp_return = cpp_method.return_type;
+    const auto c_return_is_void =
+        cpp_return->kind == NodeKind::BuiltinType &&
+        static_cast<const NodeBuiltinType*>(cpp_return.get())->type_name ==
+            "void";
+    // An enum's c type is a record type, so convert_return() would copy it
+    // out with to_c_copy(), which only exists for records. Enums are cast by
+    // explicitly named functions instead (see build_enum_cast_name()), which
+    // convert_return() has no way to reach.
+    if (!c_return_is_void &&
+        (cpp_return->kind == NodeKind::EnumType ||
+         !is_batch_element(type_registry, cpp_return))) {
+        SPDLOG_WARN("Ignoring CPPMM_BATCH on {}, only methods returning void, "
+                    "builtins or records stored by value can be batched",
+                    cpp_method.name);
+        return;
+    }
+
+    auto index = NodeVarRefExpr::n("i");
+
+    // this_ is the first of n records
+    auto c_params = std::vector<Param>();
+    c_params.push_back(
+        this_param(cpp_record, c_record, cpp_method.is_const, false));
+    auto this_ = NodeFunctionCallExpr::n(
+        "to_cpp",
+        std::vector<NodeExprPtr>({NodeInfixOperatorExpr::n(
+            "+", std::vector<NodeExprPtr>({NodeVarRefExpr::n(THIS_), index}),
+            std::vector<NodeTypePtr>{})}),
+        std::vector<NodeTypePtr>{});
+
+    auto args = std::vector<NodeExprPtr>();
+    for (const auto& p : cpp_method.params) {
+        NodeExprPtr element;
+        if (!batch_parameter(c_tu, type_registry, c_params, p, element)) {
+            SPDLOG_WARN("Ignoring CPPMM_BATCH on {}, cannot batch type {} of "
+                        "parameter \"{}\"",
+                        cpp_method.name, p.type->type_name, p.name);
+            return;
+        }
+        args.push_back(convert_to(type_registry, p.type, element));
+    }
+
+    c_tu.header_includes.insert("#include <stddef.h>");
+    c_params.push_back(Param(std::string("n"), size_type(), c_params.size()));
+
+    NodeExprPtr call =
+        NodeMethodCallExpr::n(std::move(this_), cpp_method.short_name, args,
+                              cpp_method.template_args);
+
+    if (!c_return_is_void) {
+        auto c_return = convert_type(c_tu, type_registry, cpp_return).type;
+        c_return->const_ = false;
+        auto out = NodeInfixOperatorExpr::n(
+            "+", std::vector<NodeExprPtr>({NodeVarRefExpr::n("out"), index}),
+            std::vector<NodeTypePtr>{});
+        call = convert_return(type_registry, cpp_return, c_return, call, out);
+        auto out_type = NodePointerType::n(PointerKind::Pointer,
+                                           std::move(c_return), false);
+        c_params.push_back(
+            Param(std::string("out"), std::move(out_type), c_params.size()));
+    }
+
+    auto body = NodeBlockExpr::n(std::vector<NodeExprPtr>(
+        {NodeForExpr::n(index->var_name, NodeVarRefExpr::n("n"),
+                        NodeBlockExpr::n(std::vector<NodeExprPtr>({call}))),
+         NodeReturnExpr::n(NodeVarRefExpr::n("0"))}));
+
+    auto function_name =
+        type_registry.make_symbol_unique(c_function.name + "_batch");
+    auto function_nice_name =
+        c_function.nice_name + function_name.substr(c_function.name.size());
+
+    auto error_return = NodeBuiltinType::n(std::string("unsigned int"), 0,
+                                           std::string("unsigned int"), false);
+
+    auto c_batch_function = NodeFunction::n(
+        function_name, PLACEHOLDER_ID, std::vector<Symbol>{}, "",
+        std::move(error_return), std::move(c_params), function_nice_name,
+        fmt::format("Call {} on each of the n records at this_",
+                    cpp_method.short_name),
+        std::vector<NodeTypePtr>(cpp_method.template_args),
+        std::vector<Exception>(cpp_method.exceptions));
+
+    c_batch_function->body = body;
+    c_tu.decls.push_back(NodePtr(c_batch_function));
+}
+
 //------------------------------------------------------------------------------
 void record_method(TypeRegistry& type_registry, TranslationUnit& c_tu,
                    const NodeRecord& cpp_record, const NodeRecord& c_record,
-                   const NodeMethod& cpp_method, NodePtr& copy_constructor) {
+                   const NodeMethod& cpp_method, NodePtr& copy_constructor,
+                   NodePtr& move_constructor,
+                   NodeExprPtr body = NodeExprPtr()) {
     // Skip ignored methods
     if (!should_wrap(cpp_record, cpp_method)) {
         return;
@@ -1252,8 +1474,8 @@ void record_method(TypeRegistry& type_registry, TranslationUnit& c_tu,
     }
 
     // Convert return type
-    auto converted_return =
-        convert_type(c_tu, type_registry, cpp_method.return_type);
+    auto converted_return = convert_type(
+        c_tu, type_registry, return_value_type(cpp_method.return_type));
     auto c_return = converted_return.type;
     if (!c_return) {
         SPDLOG_ERROR("Skipping method {} due to unrecognised return type {}",
@@ -1302,10 +1524,11 @@ void record_method(TypeRegistry& type_registry, TranslationUnit& c_tu,
         }
     }
 
-    // Function body
+    // Function body, unless we've been given one
     auto c_function_body =
-        record_method_body(type_registry, c_tu, cpp_record, c_record,
-                           c_return_for_method, cpp_method);
+        body ? body
+             : record_method_body(type_registry, c_tu, cpp_record, c_record,
+                                  c_return_for_method, cpp_method);
 
     auto names =
         compute_function_names(type_registry, cpp_record, c_record, cpp_method);
@@ -1325,78 +1548,635 @@ void record_method(TypeRegistry& type_registry, TranslationUnit& c_tu,
     c_function->body = c_function_body;
     c_tu.decls.push_back(NodePtr(c_function));
 
-    // Keep hold of a reference to the copy constructor,
-    // we need this later on for implicit conversions.
-    //
-    // TODO LT: Take the move constructor with priority
-    if (cpp_method.is_copy_constructor) {
+    if (is_batch(cpp_method)) {
+        batch_method(type_registry, c_tu, cpp_record, c_record, cpp_method,
+                     *c_function);
+    }
 
+    // Keep hold of a reference to the copy and move constructors,
+    // we need these later on for implicit conversions.
+    if (cpp_method.is_copy_constructor) {
         copy_constructor = c_function;
     }
-}
-
-//------------------------------------------------------------------------------
-void record_methods(TypeRegistry& type_registry, TranslationUnit& c_tu,
-                    const NodeRecord& cpp_record, const NodeRecord& c_record,
-                    NodePtr& copy_constructor) {
-    for (const auto& m : cpp_record.methods) {
-        record_method(type_registry, c_tu, cpp_record, c_record, m,
-                      copy_constructor);
+    if (cpp_method.is_move_constructor) {
+        move_constructor = c_function;
     }
 }
 
-/*
 //------------------------------------------------------------------------------
-void opaqueptr_method(TypeRegistry& type_registry, TranslationUnit& c_tu,
-                      const NodeRecord& cpp_record, const NodeRecord& c_record,
-                      const NodeMethod& cpp_method) {
-    // Skip ignored methods
-    if (!should_wrap(cpp_record, cpp_method)) {
-        // std::cerr << "ignoring method decl: " << cpp_method.name <<
-        // std::endl;
-        return;
-    }
-
-    // Convert return type
-    auto c_return = convert_type(c_tu, type_registry, cpp_method.return_type);
-    if (!c_return) {
-        SPDLOG_ERROR("Skipping method {} due to unrecognised return type {}",
-                     cpp_method.name, cpp_method.return_type->type_name);
-        return;
-    }
-
-    // The value of the return type cannot be const. If it's a pointer type
-    // or reference the pointee type can be const, but the return value cannot.
-    c_return->const_ = false;
-
-    auto c_return_for_method = c_return;
+// Add a <constructor>_arena(this_, arena, params...) variant of a pooled
+// record's constructor, that allocates the object from the given arena
+// instead of the record's pool.
+void arena_constructor(TypeRegistry& type_registry, TranslationUnit& c_tu,
+                       const NodeRecord& cpp_record,
+                       const NodeMethod& cpp_method,
+                       const NodeFunction& c_function,
+                       const std::string& project_name) {
+    // The arena goes straight after this_
+    auto arena_type = NodePointerType::n(
+        PointerKind::Pointer,
+        NodeRecordType::n("", 0, project_name + "_arena_t", 0, false), false);
 
-    // Convert params
     auto c_params = std::vector<Param>();
-    c_params.push_back(this_param(c_record, cpp_method.is_const));
-
-    // Return value
-    auto c_return_is_void =
-        c_return->kind == NodeKind::BuiltinType &&
-        static_cast<const NodeBuiltinType*>(c_return.get())->type_name ==
-            "void";
-
-    if(!c_return_is_void) {
-        auto return_pointer =
-            NodePointerType::n(PointerKind::Pointer, std::move(c_return),
-                               false);
-        c_params.push_back(Param(std::string("return_"),
-                                 std::move(return_pointer),
+    for (const auto& p : c_function.params) {
+        c_params.push_back(Param(std::string(p.name), NodeTypePtr(p.type),
                                  c_params.size()));
+        if (c_params.size() == 1) {
+            c_params.push_back(Param(std::string("arena"),
+                                     std::move(arena_type), c_params.size()));
+        }
     }
 
+    auto args = std::vector<NodeExprPtr>({NodeVarRefExpr::n("arena")});
     for (const auto& p : cpp_method.params) {
-        if (!parameter(c_tu, type_registry, c_params, p)) {
-            SPDLOG_ERROR("Skipping method {} due to unrecognised type {} of "
-                         "parameter \"{}\"",
-                         cpp_method.name, p.type->type_name, p.name);
-            return;
-        }
+        argument(type_registry, args, p);
+    }
+
+    auto body = NodeBlockExpr::n(std::vector<NodeExprPtr>({
+        NodeFunctionCallExpr::n(
+            "to_c",
+            std::vector<NodeExprPtr>(
+                {NodeVarRefExpr::n(THIS_),
+                 NodeFunctionCallExpr::n(
+                     "tlg_arena_new", args,
+                     std::vector<NodeTypePtr>({NodeRecordType::n(
+                         "", 0, cpp_record.name, cpp_record.id, false)}))}),
+            std::vector<NodeTypePtr>{}),
+        NodeReturnExpr::n(NodeVarRefExpr::n("0")),
+    }));
+
+    auto function_name =
+        type_registry.make_symbol_unique(c_function.name + "_arena");
+    auto function_nice_name =
+        c_function.nice_name + function_name.substr(c_function.name.size());
+
+    auto error_return = NodeBuiltinType::n(std::string("unsigned int"), 0,
+                                           std::string("unsigned int"), false);
+
+    auto c_arena_function = NodeFunction::n(
+        function_name, PLACEHOLDER_ID, std::vector<Symbol>{}, "",
+        std::move(error_return), std::move(c_params), function_nice_name,
+        c_function.comment, std::vector<NodeTypePtr>(c_function.template_args),
+        std::vector<Exception>(c_function.exceptions));
+
+    c_arena_function->body = body;
+    c_tu.decls.push_back(NodePtr(c_arena_function));
+}
+
+//------------------------------------------------------------------------------
+// Add <constructor>_in_place(this_, params...) for a constructor of an
+// opaqueptr record, e.g. <record>_move_in_place for the move constructor, or
+// <record>_drop_in_place(this_) for its destructor. These construct into and
+// destroy objects in storage the caller provides, using the record's size and
+// alignment, so the objects don't have to live on the heap.
+void in_place_method(TypeRegistry& type_registry, TranslationUnit& c_tu,
+                     const NodeRecord& cpp_record, const NodeRecord& c_record,
+                     const NodeMethod& cpp_method,
+                     const NodeFunction& c_function) {
+    auto c_params = std::vector<Param>();
+    c_params.push_back(this_param(cpp_record, c_record, false, false));
+
+    for (const auto& p : cpp_method.params) {
+        if (!parameter(c_tu, type_registry, c_params, p)) {
+            return;
+        }
+    }
+
+    const auto function_prefix = pystring::slice(c_record.name, 0, -2);
+    const auto nice_prefix = pystring::slice(c_record.nice_name, 0, -2);
+
+    NodeExprPtr body;
+    std::string function_name;
+    std::string comment;
+    if (cpp_method.is_constructor) {
+        body = opaquebytes_constructor_body(type_registry, c_tu, cpp_record,
+                                            c_record, cpp_method);
+        // Named after the constructor, so callers can tell the variants apart
+        function_name =
+            type_registry.make_symbol_unique(c_function.name + "_in_place");
+        comment = fmt::format("Like {0}, but constructs into this_, which must "
+                              "point to {1}_sizeof bytes aligned to "
+                              "{1}_alignof",
+                              c_function.nice_name, nice_prefix);
+    } else {
+        body = method_body(type_registry, c_tu, cpp_record, c_record,
+                           NodeBuiltinType::n("void", 0, "void", false),
+                           cpp_method);
+        function_name = type_registry.make_symbol_unique(function_prefix +
+                                                         "_drop_in_place");
+        comment = fmt::format("Like {}, but leaves the storage at this_ to "
+                              "the caller",
+                              c_function.nice_name);
+    }
+
+    auto function_nice_name =
+        nice_prefix + function_name.substr(function_prefix.size());
+
+    auto error_return = NodeBuiltinType::n(std::string("unsigned int"), 0,
+                                           std::string("unsigned int"), false);
+
+    auto c_in_place_function = NodeFunction::n(
+        function_name, PLACEHOLDER_ID, std::vector<Symbol>{}, "",
+        std::move(error_return), std::move(c_params), function_nice_name,
+        comment,
+        std::vector<NodeTypePtr>(c_function.template_args),
+        std::vector<Exception>(c_function.exceptions));
+
+    c_in_place_function->body = body;
+    c_tu.decls.push_back(NodePtr(c_in_place_function));
+}
+
+//------------------------------------------------------------------------------
+bool is_async(const NodeFunction& cpp_function) {
+    return std::find(cpp_function.attrs.begin(), cpp_function.attrs.end(),
+                     attr::ASYNC) != cpp_function.attrs.end();
+}
+
+//------------------------------------------------------------------------------
+// Add <function>_async(params..., task), which runs the wrapper on the
+// library's worker threads and hands back a task to wait on for its result.
+// The arguments are copied, so whatever they point to, including the return
+// value, must stay alive until the task has finished.
+void async_function(TypeRegistry& type_registry, TranslationUnit& c_tu,
+                    const NodeFunction& c_function,
+                    const std::string& project_name) {
+    auto task_type = NodePointerType::n(
+        PointerKind::Pointer,
+        NodePointerType::n(
+            PointerKind::Pointer,
+            NodeRecordType::n("", 0, project_name + "_task_t", 0, false),
+            false),
+        false);
+
+    auto c_params = std::vector<Param>();
+    auto args = std::vector<NodeExprPtr>({NodeVarRefExpr::n(c_function.name)});
+    for (const auto& p : c_function.params) {
+        c_params.push_back(Param(std::string(p.name), NodeTypePtr(p.type),
+                                 c_params.size()));
+        args.push_back(NodeVarRefExpr::n(p.name));
+    }
+    c_params.push_back(
+        Param(std::string("task"), std::move(task_type), c_params.size()));
+
+    auto body = NodeBlockExpr::n(std::vector<NodeExprPtr>({
+        NodeAssignExpr::n(
+            NodeDerefExpr::n(NodeVarRefExpr::n("task")),
+            NodeFunctionCallExpr::n("tlg_task_async", args,
+                                    std::vector<NodeTypePtr>{})),
+        NodeReturnExpr::n(NodeVarRefExpr::n("0")),
+    }));
+
+    auto function_name =
+        type_registry.make_symbol_unique(c_function.name + "_async");
+    auto function_nice_name =
+        c_function.nice_name + function_name.substr(c_function.name.size());
+
+    auto error_return = NodeBuiltinType::n(std::string("unsigned int"), 0,
+                                           std::string("unsigned int"), false);
+
+    auto c_async_function = NodeFunction::n(
+        function_name, PLACEHOLDER_ID, std::vector<Symbol>({attr::ASYNC}), "",
+        std::move(error_return), std::move(c_params), function_nice_name,
+        fmt::format("Start {} on a worker thread. The result is returned by "
+                    "{}_task_result(task)",
+                    c_function.nice_name, project_name),
+        std::vector<NodeTypePtr>(c_function.template_args),
+        std::vector<Exception>(c_function.exceptions));
+
+    c_async_function->body = body;
+    c_tu.decls.push_back(NodePtr(c_async_function));
+}
+
+//------------------------------------------------------------------------------
+void record_methods(TypeRegistry& type_registry, TranslationUnit& c_tu,
+                    const NodeRecord& cpp_record, NodeRecord& c_record,
+                    NodePtr& copy_constructor, NodePtr& move_constructor,
+                    const std::string& project_name) {
+    const bool opaqueptr = bind_type(cpp_record) == BindType::OpaquePtr;
+    const bool pooled = is_pooled(cpp_record);
+    for (const auto& m : cpp_record.methods) {
+        const auto decl_count = c_tu.decls.size();
+        record_method(type_registry, c_tu, cpp_record, c_record, m,
+                      copy_constructor, move_constructor);
+
+        if (c_tu.decls.size() == decl_count) {
+            continue;
+        }
+
+        // The method's own wrapper comes first, before any variants of it
+        const auto c_function_ptr = c_tu.decls[decl_count];
+        const auto& c_function =
+            *static_cast<const NodeFunction*>(c_function_ptr.get());
+
+        if (m.is_constructor && m.params.empty()) {
+            c_record.default_constructor = c_function_ptr;
+        }
+
+        if (pooled && m.is_constructor) {
+            arena_constructor(type_registry, c_tu, cpp_record, m, c_function,
+                              project_name);
+        }
+
+        if (opaqueptr && !cpp_record.opaque_type &&
+            (m.is_constructor || m.is_destructor)) {
+            in_place_method(type_registry, c_tu, cpp_record, c_record, m,
+                            c_function);
+        }
+
+        if (is_async(m)) {
+            async_function(type_registry, c_tu, c_function, project_name);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// Pull the element type name out of a standard container record name, e.g.
+// "std::vector<float>" gives "float" for the "vector" container
+bool container_element_name(const std::string& record_name,
+                            const std::string& container,
+                            std::string& element_name) {
+    std::string args;
+    for (const auto& ns : {"std::", "std::__1::"}) {
+        const auto prefix = ns + container + "<";
+        if (pystring::startswith(record_name, prefix)) {
+            args = pystring::slice(record_name, prefix.size(), -1);
+            break;
+        }
+    }
+
+    if (args.empty()) {
+        return false;
+    }
+
+    // Stop at the comparator or allocator, if they're spelled out
+    int depth = 0;
+    for (size_t i = 0; i < args.size(); ++i) {
+        if (args[i] == '<') {
+            ++depth;
+        } else if (args[i] == '>') {
+            --depth;
+        } else if (args[i] == ',' && depth == 0) {
+            args = args.substr(0, i);
+            break;
+        }
+    }
+
+    element_name = pystring::strip(args);
+    return !element_name.empty();
+}
+
+//------------------------------------------------------------------------------
+// Find the element type of a std::vector, as long as it's something that can
+// be handed to C as an array, i.e. a builtin or a record stored by value.
+// std::vector<bool> packs its elements into bits, so it has no data() and
+// isn't one of them.
+NodeTypePtr vector_element_type(const TypeRegistry& type_registry,
+                                const NodeRecord& cpp_record) {
+    static const std::set<std::string> builtins = {
+        "char",         "signed char",        "unsigned char",
+        "short",        "unsigned short",     "int",
+        "unsigned int", "long",               "unsigned long",
+        "long long",    "unsigned long long", "float",
+        "double",
+    };
+
+    std::string element_name;
+    if (!container_element_name(cpp_record.name, "vector", element_name)) {
+        return NodeTypePtr();
+    }
+
+    if (builtins.find(element_name) != builtins.end()) {
+        return NodeBuiltinType::n(element_name, 0, element_name, false);
+    }
+
+    const auto* record = type_registry.record_cpp_by_name(element_name);
+    if (!record || bind_type(*record) == BindType::OpaquePtr) {
+        return NodeTypePtr();
+    }
+
+    return NodeRecordType::n(element_name, 0, element_name, record->id, false);
+}
+
+//------------------------------------------------------------------------------
+NodeTypePtr const_type(const NodeTypePtr& t) {
+    if (t->kind == NodeKind::BuiltinType) {
+        return NodeBuiltinType::n(t->name, 0, t->type_name, true);
+    }
+
+    const auto* rt = static_cast<const NodeRecordType*>(t.get());
+    return NodeRecordType::n(rt->name, 0, rt->type_name, rt->record, true);
+}
+
+//------------------------------------------------------------------------------
+// memcpy(dst, src, bytes). Every body using it goes through here, so that
+// <cstring> is always added to the includes of the file the body is written
+// to, rather than relying on some other header to bring it in.
+NodeExprPtr memcpy_expr(std::set<std::string>& includes, NodeExprPtr dst,
+                        NodeExprPtr src, NodeExprPtr bytes) {
+    includes.insert("#include <cstring>");
+    return NodeFunctionCallExpr::n(
+        "memcpy",
+        std::vector<NodeExprPtr>(
+            {std::move(dst), std::move(src), std::move(bytes)}),
+        std::vector<NodeTypePtr>{});
+}
+
+//------------------------------------------------------------------------------
+NodeMethod vector_method(const NodeRecord& cpp_record, const char* short_name,
+                         const char* rename, NodeTypePtr&& return_type,
+                         std::vector<Param>&& params, bool is_const) {
+    auto attrs = std::vector<Symbol>();
+    if (rename) {
+        attrs.push_back(Symbol(std::string("cppmm|rename|") + rename));
+    }
+
+    return NodeMethod(cpp_record.name + "::" + short_name, PLACEHOLDER_ID,
+                      attrs, short_name, std::move(return_type),
+                      std::move(params), false, false, false, false, false,
+                      is_const, "", std::vector<NodeTypePtr>(),
+                      std::vector<Exception>());
+}
+
+//------------------------------------------------------------------------------
+bool has_method(const NodeRecord& cpp_record, const std::string& short_name) {
+    for (const auto& m : cpp_record.methods) {
+        if (m.short_name == short_name) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//------------------------------------------------------------------------------
+// Add the record method and return the c function it created, if any
+NodePtr vector_record_method(TypeRegistry& type_registry,
+                             TranslationUnit& c_tu,
+                             const NodeRecord& cpp_record,
+                             const NodeRecord& c_record,
+                             const NodeMethod& cpp_method,
+                             NodeExprPtr body = NodeExprPtr()) {
+    NodePtr copy_constructor;
+    NodePtr move_constructor;
+    const auto num_decls = c_tu.decls.size();
+    record_method(type_registry, c_tu, cpp_record, c_record, cpp_method,
+                  copy_constructor, move_constructor, std::move(body));
+
+    if (c_tu.decls.size() == num_decls) {
+        return NodePtr();
+    }
+    return c_tu.decls.back();
+}
+
+//------------------------------------------------------------------------------
+bool element_is_trivially_copyable(const TypeRegistry& type_registry,
+                                   const NodeTypePtr& element_type) {
+    if (element_type->kind == NodeKind::BuiltinType) {
+        return true;
+    }
+
+    const auto* rt = static_cast<const NodeRecordType*>(element_type.get());
+    return type_registry.record_c(rt->record)->trivially_copyable;
+}
+
+//------------------------------------------------------------------------------
+// Bulk copies between a std::vector and a C array, so that a whole buffer
+// crosses in a single call:
+//
+// assign_from(const T* ptr, size_t len) replaces the contents with the len
+// elements at ptr.
+// copy_to(T* ptr, size_t len) copies up to len elements into ptr.
+//
+// copy_to reads through data(), so element_type must come from
+// vector_element_type(), which leaves out std::vector<bool>.
+void vector_copy_methods(TypeRegistry& type_registry, TranslationUnit& c_tu,
+                         const NodeRecord& cpp_record,
+                         const NodeRecord& c_record,
+                         const NodeTypePtr& element_type) {
+    auto copy_params = [&](bool const_) {
+        auto element = const_ ? const_type(element_type) : element_type;
+        auto params = std::vector<Param>();
+        params.push_back(Param(
+            std::string("ptr"),
+            NodePointerType::n(PointerKind::Pointer, std::move(element), false),
+            0));
+        params.push_back(Param(std::string("len"), size_type(), 1));
+        return params;
+    };
+
+    auto this_ = [&](bool const_) {
+        return this_reference(cpp_record, const_);
+    };
+
+    const bool trivially_copyable =
+        element_is_trivially_copyable(type_registry, element_type);
+
+    if (!has_method(cpp_record, "assign_from")) {
+        auto method = vector_method(cpp_record, "assign_from", nullptr,
+                                    void_type(), copy_params(true), false);
+        method.comment = "Replace the contents with the len elements at ptr";
+        auto ptr = convert_to(type_registry, method.params[0].type,
+                              NodeVarRefExpr::n("ptr"));
+
+        // this->assign(ptr, ptr + len)
+        // For trivially copyable elements this is a single allocation and
+        // memmove, otherwise a copy loop.
+        auto end = NodeInfixOperatorExpr::n(
+            "+", std::vector<NodeExprPtr>({ptr, NodeVarRefExpr::n("len")}),
+            std::vector<NodeTypePtr>{});
+        auto body = NodeBlockExpr::n(std::vector<NodeExprPtr>(
+            {NodeMethodCallExpr::n(this_(false), "assign",
+                                   std::vector<NodeExprPtr>({ptr, end}),
+                                   std::vector<NodeTypePtr>{}),
+             NodeReturnExpr::n(NodeVarRefExpr::n("0"))}));
+
+        vector_record_method(type_registry, c_tu, cpp_record, c_record, method,
+                             std::move(body));
+    }
+
+    if (!has_method(cpp_record, "copy_to")) {
+        auto method = vector_method(cpp_record, "copy_to", nullptr,
+                                    void_type(), copy_params(false), true);
+        method.comment = "Copy up to len elements into the already constructed "
+                         "elements at ptr";
+        auto ptr = convert_to(type_registry, method.params[0].type,
+                              NodeVarRefExpr::n("ptr"));
+
+        // std::min<size_t>(len, this->size())
+        auto count = NodeFunctionCallExpr::n(
+            "std::min",
+            std::vector<NodeExprPtr>(
+                {NodeVarRefExpr::n("len"),
+                 NodeMethodCallExpr::n(this_(true), "size",
+                                       std::vector<NodeExprPtr>{},
+                                       std::vector<NodeTypePtr>{})}),
+            std::vector<NodeTypePtr>({size_type()}));
+        auto data =
+            NodeMethodCallExpr::n(this_(true), "data",
+                                  std::vector<NodeExprPtr>{},
+                                  std::vector<NodeTypePtr>{});
+
+        NodeExprPtr copy;
+        if (trivially_copyable) {
+            // memcpy(ptr, this->data(), count * sizeof(*ptr))
+            auto bytes = NodeInfixOperatorExpr::n(
+                "*",
+                std::vector<NodeExprPtr>(
+                    {count, NodeFunctionCallExpr::n(
+                                "sizeof",
+                                std::vector<NodeExprPtr>(
+                                    {NodeDerefExpr::n(NodeExprPtr(ptr))}),
+                                std::vector<NodeTypePtr>{})}),
+                std::vector<NodeTypePtr>{});
+            copy = memcpy_expr(c_tu.source_includes, ptr, data, bytes);
+        } else {
+            // std::copy_n(this->data(), count, ptr)
+            copy = NodeFunctionCallExpr::n(
+                "std::copy_n", std::vector<NodeExprPtr>({data, count, ptr}),
+                std::vector<NodeTypePtr>{});
+        }
+
+        auto body = NodeBlockExpr::n(std::vector<NodeExprPtr>(
+            {copy, NodeReturnExpr::n(NodeVarRefExpr::n("0"))}));
+
+        vector_record_method(type_registry, c_tu, cpp_record, c_record, method,
+                             std::move(body));
+    }
+
+    c_tu.source_includes.insert("#include <algorithm>");
+}
+
+//------------------------------------------------------------------------------
+// Give std::vectors of builtins and records stored by value bulk copies to and
+// from C arrays, and for builtins and value types, access to their storage so
+// their contents can be passed across without going element by element.
+// Anything already declared in the binding is left alone.
+void vector_methods(TypeRegistry& type_registry, TranslationUnit& c_tu,
+                    const NodeRecord& cpp_record, NodeRecord& c_record) {
+    auto element_type = vector_element_type(type_registry, cpp_record);
+    if (!element_type) {
+        return;
+    }
+
+    vector_copy_methods(type_registry, c_tu, cpp_record, c_record,
+                        element_type);
+
+    // Every vector with the copy methods needs its size so callers know how
+    // big a buffer to hand to copy_to
+    if (!has_method(cpp_record, "size")) {
+        c_record.size_function = vector_record_method(
+            type_registry, c_tu, cpp_record, c_record,
+            vector_method(cpp_record, "size", nullptr, size_type(),
+                          std::vector<Param>(), true));
+    }
+
+    // Only builtins and value types have the same representation in C
+    if (element_type->kind == NodeKind::RecordType) {
+        const auto* rt = static_cast<const NodeRecordType*>(element_type.get());
+        if (bind_type(*type_registry.record_c(rt->record)) !=
+            BindType::ValueType) {
+            return;
+        }
+    }
+
+    auto size_param = [&] {
+        auto params = std::vector<Param>();
+        params.push_back(Param(std::string("n"), size_type(), 0));
+        return params;
+    };
+
+    if (!has_method(cpp_record, "data")) {
+        // const T* data() const
+        auto const_element = const_type(element_type);
+
+        c_record.data_function = vector_record_method(
+            type_registry, c_tu, cpp_record, c_record,
+            vector_method(cpp_record, "data", nullptr,
+                          NodePointerType::n(PointerKind::Pointer,
+                                             std::move(const_element), false),
+                          std::vector<Param>(), true));
+
+        // T* data()
+        c_record.data_mut_function = vector_record_method(
+            type_registry, c_tu, cpp_record, c_record,
+            vector_method(cpp_record, "data", "data_mut",
+                          NodePointerType::n(PointerKind::Pointer,
+                                             NodeTypePtr(element_type), false),
+                          std::vector<Param>(), false));
+    }
+
+    if (!has_method(cpp_record, "capacity")) {
+        vector_record_method(type_registry, c_tu, cpp_record, c_record,
+                             vector_method(cpp_record, "capacity", nullptr,
+                                           size_type(), std::vector<Param>(),
+                                           true));
+    }
+
+    if (!has_method(cpp_record, "reserve")) {
+        vector_record_method(type_registry, c_tu, cpp_record, c_record,
+                             vector_method(cpp_record, "reserve", nullptr,
+                                           void_type(), size_param(), false));
+    }
+
+    if (!has_method(cpp_record, "resize")) {
+        vector_record_method(type_registry, c_tu, cpp_record, c_record,
+                             vector_method(cpp_record, "resize", nullptr,
+                                           void_type(), size_param(), false));
+    }
+}
+
+/*
+//------------------------------------------------------------------------------
+void opaqueptr_method(TypeRegistry& type_registry, TranslationUnit& c_tu,
+                      const NodeRecord& cpp_record, const NodeRecord& c_record,
+                      const NodeMethod& cpp_method) {
+    // Skip ignored methods
+    if (!should_wrap(cpp_record, cpp_method)) {
+        // std::cerr << "ignoring method decl: " << cpp_method.name <<
+        // std::endl;
+        return;
+    }
+
+    // Convert return type
+    auto c_return = convert_type(c_tu, type_registry, cpp_method.return_type);
+    if (!c_return) {
+        SPDLOG_ERROR("Skipping method {} due to unrecognised return type {}",
+                     cpp_method.name, cpp_method.return_type->type_name);
+        return;
+    }
+
+    // The value of the return type cannot be const. If it's a pointer type
+    // or reference the pointee type can be const, but the return value cannot.
+    c_return->const_ = false;
+
+    auto c_return_for_method = c_return;
+
+    // Convert params
+    auto c_params = std::vector<Param>();
+    c_params.push_back(this_param(c_record, cpp_method.is_const));
+
+    // Return value
+    auto c_return_is_void =
+        c_return->kind == NodeKind::BuiltinType &&
+        static_cast<const NodeBuiltinType*>(c_return.get())->type_name ==
+            "void";
+
+    if(!c_return_is_void) {
+        auto return_pointer =
+            NodePointerType::n(PointerKind::Pointer, std::move(c_return),
+                               false);
+        c_params.push_back(Param(std::string("return_"),
+                                 std::move(return_pointer),
+                                 c_params.size()));
+    }
+
+    for (const auto& p : cpp_method.params) {
+        if (!parameter(c_tu, type_registry, c_params, p)) {
+            SPDLOG_ERROR("Skipping method {} due to unrecognised type {} of "
+                         "parameter \"{}\"",
+                         cpp_method.name, p.type->type_name, p.name);
+            return;
+        }
     }
 
     if (bind_type(cpp_record) == BindType::OpaquePtr &&
@@ -1426,7 +2206,7 @@ void opaqueptr_method(TypeRegistry& type_registry, TranslationUnit& c_tu,
     // that share a common suffix but with different prefixes
     // The full prefix we get by stripping the "_t" from the struct name
     std::string function_prefix = pystring::slice(c_record.name, 0, -2);
-    std::string function_suffix = compute_c_name(short_name);
+    std::string function_suffix = naming::to_c_name(short_name);
     std::string function_name = function_prefix + "_" + function_suffix;
     function_name = type_registry.make_symbol_unique(function_name);
 
@@ -1466,10 +2246,10 @@ void record_entry(NodeId& record_id, TypeRegistry& type_registry,
                   TranslationUnit::Ptr& c_tu, const NodePtr& cpp_node) {
     const auto& cpp_record = *static_cast<const NodeRecord*>(cpp_node.get());
 
-    const auto c_record_name = compute_c_name(cpp_record.name) + "_t";
+    const auto c_record_name = naming::to_c_name(cpp_record.name.str()) + "_t";
     const auto nice_name =
-        compute_qualified_nice_name(type_registry, cpp_record.namespaces,
-                                    cpp_record.alias) +
+        type_registry.qualified_nice_name(cpp_record.namespaces,
+                                          cpp_record.alias) +
         "_t";
 
     // Create the c record
@@ -1497,10 +2277,9 @@ void function_pointer_typedef_entry(NodeId& fpt_id, TypeRegistry& type_registry,
     const auto& cpp_fpt =
         *static_cast<const NodeFunctionPointerTypedef*>(cpp_node.get());
 
-    const auto c_fpt_name = compute_c_name(cpp_fpt.name);
+    const auto c_fpt_name = naming::to_c_name(cpp_fpt.name.str());
     const auto nice_name =
-        compute_qualified_nice_name(type_registry, cpp_fpt.namespaces,
-                                    cpp_fpt.alias) +
+        type_registry.qualified_nice_name(cpp_fpt.namespaces, cpp_fpt.alias) +
         "_t";
     SPDLOG_TRACE("Adding FPT {} -> {} with id {}", c_fpt_name, nice_name,
                  cpp_fpt.id);
@@ -1518,127 +2297,6 @@ void function_pointer_typedef_entry(NodeId& fpt_id, TypeRegistry& type_registry,
     c_tu->decls.push_back(std::move(c_fpt));
 }
 
-//------------------------------------------------------------------------------
-void cast_to_cpp(TranslationUnit& c_tu, const std::string& cpp_record_name,
-                 NodeId cpp_record_id, const std::string& c_record_name,
-                 NodeId c_record_id, bool const_, PointerKind pointer_kind,
-                 BindType bind_type,
-                 const std::string& prefix = std::string()) {
-    auto rhs = NodePointerType::n(
-        PointerKind::Pointer,
-        NodeRecordType::n("", 0, c_record_name, c_record_id, const_), false);
-
-    auto cpp_return = NodePointerType::n(
-        pointer_kind,
-        NodeRecordType::n("", 0, cpp_record_name, cpp_record_id, const_),
-        false);
-
-    // Data reference
-    auto data_reference = (bind_type == BindType::OpaquePtr)
-                              ? NodeVarRefExpr::n("rhs->data")
-                              : NodeVarRefExpr::n("rhs");
-
-    // Cast type
-    NodeExprPtr cast_expr = NodeCastExpr::n(
-        NodeVarRefExpr::n("rhs"),
-        NodePointerType::n(
-            PointerKind::Pointer,
-            NodeRecordType::n("", 0, cpp_record_name, cpp_record_id, const_),
-            false),
-        "reinterpret");
-
-    if (pointer_kind == PointerKind::Reference) {
-        cast_expr = NodeDerefExpr::n(std::move(cast_expr));
-    }
-
-    // Function body
-    auto c_function_body = NodeBlockExpr::n(std::vector<NodeExprPtr>({
-        NodeReturnExpr::n(std::move(cast_expr)),
-    }));
-
-    // Add the new function to the translation unit
-    std::vector<std::string> attrs;
-    std::vector<Param> params = {Param("rhs", rhs, 0)};
-    std::string function_name = prefix + "to_cpp";
-    if (pointer_kind == PointerKind::Reference) {
-        function_name += "_ref";
-    }
-    auto c_function =
-        NodeFunction::n(function_name, PLACEHOLDER_ID, attrs, "",
-                        std::move(cpp_return), std::move(params), "", "",
-                        std::vector<NodeTypePtr>{}, std::vector<Exception>{});
-
-    c_function->body = c_function_body;
-    c_function->private_ = true;
-    c_function->inline_ = true;
-
-    c_tu.decls.push_back(std::move(c_function));
-}
-
-//------------------------------------------------------------------------------
-void cast_to_c(TranslationUnit& c_tu, const std::string& cpp_record_name,
-               NodeId cpp_record_id, const std::string& c_record_name,
-               NodeId c_record_id, bool const_, PointerKind pointer_kind,
-               BindType bind_type, const std::string& prefix = std::string()) {
-    auto rhs = NodePointerType::n(
-        pointer_kind,
-        NodeRecordType::n("", 0, cpp_record_name, cpp_record_id, const_),
-        false);
-
-    auto c_return = NodePointerType::n(
-        PointerKind::Pointer,
-        NodeRecordType::n("", 0, c_record_name, c_record_id, const_), false);
-
-    NodeExprPtr var_ref_expr = NodeVarRefExpr::n("rhs");
-    if (pointer_kind == PointerKind::Reference) {
-        var_ref_expr = NodeRefExpr::n(std::move(var_ref_expr));
-    }
-
-    // Cast type
-    NodeExprPtr cast_expr = NodeCastExpr::n(
-        std::move(var_ref_expr),
-        NodePointerType::n(
-            PointerKind::Pointer,
-            NodeRecordType::n("", 0, c_record_name, c_record_id, const_),
-            false),
-        "reinterpret");
-
-    // Function body
-    auto c_function_body = NodeBlockExpr::n(std::vector<NodeExprPtr>({
-        NodeAssignExpr::n(NodeDerefExpr::n(NodeVarRefExpr::n("lhs")),
-                          std::move(cast_expr)),
-    }));
-
-    // opaquebytes need an additional pointer
-    auto lhs = NodePointerType::n(PointerKind::Pointer, c_return, false);
-#if 0
-    auto is_opaqueptr = bind_type == BindType::OpaquePtr;
-    if (is_opaqueptr)
-    {
-        lhs = NodePointerType::n(PointerKind::Pointer, std::move(lhs), false);
-    }
-#endif
-
-    // Function name
-    auto function_name = prefix;
-    function_name += "to_c";
-
-    // Add the new function to the translation unit
-    std::vector<std::string> attrs;
-    std::vector<Param> params = {Param("lhs", lhs, 0), Param("rhs", rhs, 1)};
-    auto void_t = NodeBuiltinType::n("void", 0, "void", false);
-    auto c_function =
-        NodeFunction::n(function_name, PLACEHOLDER_ID, attrs, "",
-                        std::move(void_t), std::move(params), "", "",
-                        std::vector<NodeTypePtr>{}, std::vector<Exception>{});
-
-    c_function->body = c_function_body;
-    c_function->private_ = true;
-    c_function->inline_ = true;
-
-    c_tu.decls.push_back(std::move(c_function));
-}
-
 //------------------------------------------------------------------------------
 void to_c_copy__trivial(TranslationUnit& c_tu,
                         const std::string& cpp_record_name,
@@ -1651,30 +2309,24 @@ void to_c_copy__trivial(TranslationUnit& c_tu,
 
     auto c_return = NodeRecordType::n("", 0, c_record_name, c_record_id, false);
 
-    // Add the include needed for memcpy
-    c_tu.private_includes.insert("#include <cstring>");
-
-    // Function body
+    // Function body, which lives in the private header
     auto c_function_body = NodeBlockExpr::n(std::vector<NodeExprPtr>(
         {// memcpy(&result, &rhs, sizeof(result))
-         NodeFunctionCallExpr::n(
-             "memcpy",
-             std::vector<NodeExprPtr>(
-                 {NodeVarRefExpr::n("lhs"),
-                  NodeRefExpr::n(NodeVarRefExpr::n("rhs")),
-                  NodeFunctionCallExpr::n(
-                      "sizeof",
-                      std::vector<NodeExprPtr>(
-                          {NodeDerefExpr::n(NodeVarRefExpr::n("lhs"))}),
-                      std::vector<NodeTypePtr>{})}),
-             std::vector<NodeTypePtr>{})}));
+         memcpy_expr(
+             c_tu.private_includes, NodeVarRefExpr::n("lhs"),
+             NodeRefExpr::n(NodeVarRefExpr::n("rhs")),
+             NodeFunctionCallExpr::n(
+                 "sizeof",
+                 std::vector<NodeExprPtr>(
+                     {NodeDerefExpr::n(NodeVarRefExpr::n("lhs"))}),
+                 std::vector<NodeTypePtr>{}))}));
 
     // Function name
     auto function_name = prefix;
     function_name += "to_c_copy";
 
     // Add the new function to the translation unit
-    std::vector<std::string> attrs;
+    std::vector<Symbol> attrs;
     std::vector<Param> params = {
         Param("lhs", NodePointerType::n(PointerKind::Pointer, c_return, false),
               0),
@@ -1694,33 +2346,10 @@ void to_c_copy__trivial(TranslationUnit& c_tu,
 //------------------------------------------------------------------------------
 void enum_conversions(TranslationUnit& c_tu, const NodeEnum& cpp_enum,
                       const NodeTypedef& c_enum) {
-    const auto& c_n = c_enum.name;
-    const auto& c_id = c_enum.id;
-    const auto& cpp_n = cpp_enum.name;
-    const auto& cpp_id = cpp_enum.id;
-
-    // Function prefix
-    auto p = c_n;
-    p += "_";
-
-    auto b = BindType::ValueType;
-    auto ref = PointerKind::Reference;
-    auto pointer = PointerKind::Pointer;
-
-    // Conversions for going from c to cpp
-    cast_to_cpp(c_tu, cpp_n, cpp_id, c_n, c_id, true, ref, b, p);
-    cast_to_cpp(c_tu, cpp_n, cpp_id, c_n, c_id, false, ref, b, p);
-    cast_to_cpp(c_tu, cpp_n, cpp_id, c_n, c_id, true, pointer, b, p);
-    cast_to_cpp(c_tu, cpp_n, cpp_id, c_n, c_id, false, pointer, b, p);
-
-    // Conversions for going from cpp to c
-    cast_to_c(c_tu, cpp_n, cpp_id, c_n, c_id, true, ref, b);
-    cast_to_c(c_tu, cpp_n, cpp_id, c_n, c_id, true, pointer, b);
-    cast_to_c(c_tu, cpp_n, cpp_id, c_n, c_id, false, ref, b);
-    cast_to_c(c_tu, cpp_n, cpp_id, c_n, c_id, false, pointer, b);
-
-    // Enum conversion is always bitwise copy
-    to_c_copy__trivial(c_tu, cpp_n, cpp_id, c_n, c_id);
+    // Enum conversion is always bitwise copy. The casts are named where
+    // they're used, see build_enum_cast_name
+    to_c_copy__trivial(c_tu, cpp_enum.name, cpp_enum.id, c_enum.name,
+                       c_enum.id);
 }
 
 //------------------------------------------------------------------------------
@@ -1751,10 +2380,10 @@ void enum_entry(NodeId& new_id, TypeRegistry& type_registry,
                 TranslationUnit::Ptr& c_tu, const NodePtr& cpp_node) {
     const auto& cpp_enum = *static_cast<NodeEnum*>(cpp_node.get());
 
-    auto c_enum_name = compute_c_name(cpp_enum.name) + "_e";
+    auto c_enum_name = naming::to_c_name(cpp_enum.name.str()) + "_e";
 
-    auto c_typedef_name = compute_qualified_nice_name(
-        type_registry, cpp_enum.namespaces, cpp_enum.short_name);
+    auto c_typedef_name = type_registry.qualified_nice_name(
+        cpp_enum.namespaces, cpp_enum.short_name);
 
     // Create the new enum variants with their namespaced names
     std::vector<std::pair<std::string, std::string>> variants;
@@ -1800,8 +2429,8 @@ void general_function(TypeRegistry& type_registry, TranslationUnit& c_tu,
     }
 
     // Convert return type
-    auto converted_return =
-        convert_type(c_tu, type_registry, cpp_function.return_type);
+    auto converted_return = convert_type(
+        c_tu, type_registry, return_value_type(cpp_function.return_type));
     auto c_return = converted_return.type;
     if (!c_return) {
         SPDLOG_ERROR("Skipping function {} due to unrecognised return type {}",
@@ -1855,15 +2484,12 @@ void general_function(TypeRegistry& type_registry, TranslationUnit& c_tu,
 
     if( c_record == nullptr )
     {
-        function_name = compute_c_name(
-            compute_qualified_name( type_registry, cpp_function.namespaces,
-                                    find_function_short_name(cpp_function))
-        );
-
-        function_nice_name =
-            compute_c_name(compute_qualified_nice_name(
-                           type_registry, cpp_function.namespaces,
-                           find_function_short_name(cpp_function)));
+        const auto short_name = find_function_short_name(cpp_function);
+        function_name = naming::to_c_name(
+            type_registry.qualified_name(cpp_function.namespaces, short_name));
+        function_nice_name = naming::to_c_name(
+            type_registry.qualified_nice_name(cpp_function.namespaces,
+                                              short_name));
     } else {
         auto names =
             compute_function_names(type_registry, *cpp_record, *c_record,
@@ -1897,11 +2523,19 @@ void general_function(TypeRegistry& type_registry, TranslationUnit& c_tu,
 
 //------------------------------------------------------------------------------
 void function_detail(TypeRegistry& type_registry, TranslationUnit& c_tu,
-                     const NodePtr& cpp_node) {
+                     const NodePtr& cpp_node, const std::string& project_name) {
     const NodeFunction& cpp_function =
         *static_cast<const NodeFunction*>(cpp_node.get());
 
+    const auto decl_count = c_tu.decls.size();
     general_function(type_registry, c_tu, cpp_function);
+
+    if (c_tu.decls.size() != decl_count && is_async(cpp_function)) {
+        async_function(
+            type_registry, c_tu,
+            *static_cast<const NodeFunction*>(c_tu.decls.back().get()),
+            project_name);
+    }
 }
 
 //------------------------------------------------------------------------------
@@ -1958,7 +2592,68 @@ void to_c_copy__constructor(TranslationUnit& c_tu, const NodeRecord& cpp_record,
     }
 
     // Add the new function to the translation unit
-    std::vector<std::string> attrs;
+    std::vector<Symbol> attrs;
+    std::vector<Param> params = {
+        Param("lhs", lhs, 0),
+        Param("rhs", rhs, 1),
+    };
+    auto c_function = NodeFunction::n(
+        "to_c_copy", PLACEHOLDER_ID, attrs, "",
+        NodeBuiltinType::n("void", 0, "void", false), std::move(params), "", "",
+        std::vector<NodeTypePtr>{}, std::vector<Exception>{});
+
+    c_function->body = c_function_body;
+    c_function->private_ = true;
+    c_function->inline_ = true;
+
+    c_tu.decls.push_back(std::move(c_function));
+}
+
+//------------------------------------------------------------------------------
+void to_c_copy__move_constructor(TranslationUnit& c_tu,
+                                 const NodeRecord& cpp_record,
+                                 const NodeRecord& c_record,
+                                 const NodePtr& move_constructor_ptr) {
+    const auto& move_constructor =
+        *static_cast<const NodeFunction*>(move_constructor_ptr.get());
+
+    auto rhs = NodePointerType::n(
+        PointerKind::RValueReference,
+        NodeRecordType::n("", 0, cpp_record.name, cpp_record.id, false),
+        false);
+
+    auto c_return =
+        NodeRecordType::n("", 0, c_record.nice_name, c_record.id, false);
+
+    // Function body
+    auto c_function_body = NodeBlockExpr::n(std::vector<NodeExprPtr>({
+        // move_constructor(&result, reinterpret_cast<CTYPE *>(rhs))
+        NodeFunctionCallExpr::n(
+            move_constructor.name,
+            std::vector<NodeExprPtr>(
+                {NodeVarRefExpr::n("lhs"),
+                 NodeCastExpr::n(
+                     NodeRefExpr::n(NodeVarRefExpr::n("rhs")),
+                     NodePointerType::n(PointerKind::Pointer,
+                                        NodeRecordType::n("", 0,
+                                                          c_record.nice_name,
+                                                          c_record.id, false),
+                                        false),
+                     "reinterpret")}),
+
+            std::vector<NodeTypePtr>{}),
+    }));
+
+    auto lhs =
+        NodePointerType::n(PointerKind::Pointer, std::move(c_return), false);
+
+    auto is_opaqueptr = bind_type(cpp_record) == BindType::OpaquePtr;
+    if (is_opaqueptr) {
+        lhs = NodePointerType::n(PointerKind::Pointer, std::move(lhs), false);
+    }
+
+    // Add the new function to the translation unit
+    std::vector<Symbol> attrs;
     std::vector<Param> params = {
         Param("lhs", lhs, 0),
         Param("rhs", rhs, 1),
@@ -1978,27 +2673,13 @@ void to_c_copy__constructor(TranslationUnit& c_tu, const NodeRecord& cpp_record,
 //------------------------------------------------------------------------------
 void record_conversions(TranslationUnit& c_tu, const NodeRecord& cpp_record,
                         const NodeRecord& c_record,
-                        const NodePtr& copy_constructor) {
-    const auto& c_n = c_record.nice_name;
-    const auto& c_id = c_record.id;
-    const auto& cpp_n = cpp_record.name;
-    const auto& cpp_id = cpp_record.id;
-
-    auto b = bind_type(cpp_record);
-    auto ref = PointerKind::Reference;
-    auto pointer = PointerKind::Pointer;
-
-    // Conversions for going from cpp to c
-    cast_to_cpp(c_tu, cpp_n, cpp_id, c_n, c_id, true, ref, b);
-    cast_to_cpp(c_tu, cpp_n, cpp_id, c_n, c_id, false, ref, b);
-    cast_to_cpp(c_tu, cpp_n, cpp_id, c_n, c_id, true, pointer, b);
-    cast_to_cpp(c_tu, cpp_n, cpp_id, c_n, c_id, false, pointer, b);
-
-    // Conversions for going from c to cpp
-    cast_to_c(c_tu, cpp_n, cpp_id, c_n, c_id, true, ref, b);
-    cast_to_c(c_tu, cpp_n, cpp_id, c_n, c_id, true, pointer, b);
-    cast_to_c(c_tu, cpp_n, cpp_id, c_n, c_id, false, ref, b);
-    cast_to_c(c_tu, cpp_n, cpp_id, c_n, c_id, false, pointer, b);
+                        const NodePtr& copy_constructor,
+                        const NodePtr& move_constructor) {
+    // The to_cpp, to_cpp_ref and to_c casts between the two types are all
+    // reinterpret_casts, so rather than a set of overloads per record they
+    // come from cppmm::cast, with a line in the private header pairing the
+    // types
+    c_tu.casts.emplace_back(c_record.nice_name, cpp_record.name);
 
     // Copy conversions.
     // Use copy constructor if its available, or fallback to bitwise copy
@@ -2009,30 +2690,14 @@ void record_conversions(TranslationUnit& c_tu, const NodeRecord& cpp_record,
         to_c_copy__trivial(c_tu, cpp_record.name, cpp_record.id,
                            c_record.nice_name, c_record.id);
     }
-}
 
-/*
-//------------------------------------------------------------------------------
-void opaqueptr_conversions(TranslationUnit& c_tu, const NodeRecord& cpp_record,
-                           const NodeRecord& c_record) {
-    const auto& c_n = c_record.nice_name;
-    const auto& c_id = c_record.id;
-    const auto& cpp_n = cpp_record.name;
-    const auto& cpp_id = cpp_record.id;
-
-    // Conversions for going from cpp to c
-    cast_to_cpp(c_tu, cpp_n, cpp_id, c_n, c_id, true, PointerKind::Reference);
-    cast_to_cpp(c_tu, cpp_n, cpp_id, c_n, c_id, false, PointerKind::Reference);
-    cast_to_cpp(c_tu, cpp_n, cpp_id, c_n, c_id, true, PointerKind::Pointer);
-    cast_to_cpp(c_tu, cpp_n, cpp_id, c_n, c_id, false, PointerKind::Pointer);
-
-    // Conversions for going from c to cpp
-    cast_to_c(c_tu, cpp_n, cpp_id, c_n, c_id, true, PointerKind::Reference);
-    cast_to_c(c_tu, cpp_n, cpp_id, c_n, c_id, true, PointerKind::Pointer);
-    cast_to_c(c_tu, cpp_n, cpp_id, c_n, c_id, false, PointerKind::Reference);
-    cast_to_c(c_tu, cpp_n, cpp_id, c_n, c_id, false, PointerKind::Pointer);
+    // Values returned from C++ are temporaries, so when there's a move
+    // constructor add an overload that moves them into the result instead
+    if (move_constructor) {
+        to_c_copy__move_constructor(c_tu, cpp_record, c_record,
+                                    move_constructor);
+    }
 }
-*/
 
 //------------------------------------------------------------------------------
 void valuetype_fields(TypeRegistry& type_registry, TranslationUnit& c_tu,
@@ -2069,26 +2734,110 @@ void record_fields(TypeRegistry& type_registry, TranslationUnit& c_tu,
     }
 }
 
+//------------------------------------------------------------------------------
+bool is_string_container(const NodeRecord& cpp_record) {
+    static const std::set<std::string> strings = {
+        "std::string",
+        "std::basic_string<char>",
+        "std::__cxx11::basic_string<char>",
+        "std::__1::basic_string<char>",
+    };
+
+    std::string element_name;
+    for (const auto& container : {"vector", "set"}) {
+        if (container_element_name(cpp_record.name, container, element_name)) {
+            return strings.find(element_name) != strings.end();
+        }
+    }
+
+    return false;
+}
+
+//------------------------------------------------------------------------------
+// Containers of strings can hand all their strings over in one call, packed
+// into a single buffer with an array of offsets:
+//
+// string_table(char* buffer, size_t buffer_len, size_t* offsets,
+//              size_t offsets_len, size_t* bytes, size_t* count)
+//
+// The packing itself is done by tlg_string_table(), see
+// write::cstringtable()
+void string_table_method(TypeRegistry& type_registry, TranslationUnit& c_tu,
+                         const NodeRecord& cpp_record, NodeRecord& c_record) {
+    if (!is_string_container(cpp_record) ||
+        has_method(cpp_record, "string_table")) {
+        return;
+    }
+
+    auto pointer = [](NodeTypePtr&& t) {
+        return NodePointerType::n(PointerKind::Pointer, std::move(t), false);
+    };
+
+    auto params = std::vector<Param>();
+    params.push_back(Param(
+        std::string("buffer"),
+        pointer(NodeBuiltinType::n("char", 0, "char", false)), 0));
+    params.push_back(Param(std::string("buffer_len"), size_type(), 1));
+    params.push_back(Param(std::string("offsets"), pointer(size_type()), 2));
+    params.push_back(Param(std::string("offsets_len"), size_type(), 3));
+    params.push_back(Param(std::string("bytes"), pointer(size_type()), 4));
+    params.push_back(Param(std::string("count"), pointer(size_type()), 5));
+
+    auto method = vector_method(cpp_record, "string_table", nullptr,
+                                void_type(), std::move(params), true);
+    method.comment =
+        "Pack all the strings into buffer, one after the other without "
+        "terminators, with the offset of each in offsets followed by the end "
+        "offset. The total size is written to bytes and the number of strings "
+        "to count. Nothing is packed if buffer or offsets are too small.";
+
+    auto args = std::vector<NodeExprPtr>(
+        {NodeDerefExpr::n(this_reference(cpp_record, true))});
+    for (const auto& p : method.params) {
+        args.push_back(NodeVarRefExpr::n(p.name));
+    }
+
+    auto body = NodeBlockExpr::n(std::vector<NodeExprPtr>(
+        {NodeFunctionCallExpr::n("tlg_string_table", args,
+                                 std::vector<NodeTypePtr>{}),
+         NodeReturnExpr::n(NodeVarRefExpr::n("0"))}));
+
+    c_record.string_table_function = vector_record_method(
+        type_registry, c_tu, cpp_record, c_record, method, std::move(body));
+}
+
 //------------------------------------------------------------------------------
 void record_detail(TypeRegistry& type_registry, TranslationUnit& c_tu,
-                   const NodePtr& cpp_node) {
+                   const NodePtr& cpp_node, const std::string& project_name) {
     const auto& cpp_record = *static_cast<NodeRecord*>(cpp_node.get());
 
     // Most simple record implementation is the opaque bytes.
     // Least safe and most restrictive in use, but easiest to implement.
     // So doing that first. Later will switch depending on the cppm attributes.
-    auto& c_record = type_registry.edit_c(
-        cpp_record.id); // TODO LT: Return optional for error
+    auto& c_record = type_registry.edit_c(cpp_record.id);
 
     // Record
     record_fields(type_registry, c_tu, cpp_record, c_record);
 
     // Methods
+    const auto decl_count = c_tu.decls.size();
     NodePtr copy_constructor;
-    record_methods(type_registry, c_tu, cpp_record, c_record, copy_constructor);
+    NodePtr move_constructor;
+    record_methods(type_registry, c_tu, cpp_record, c_record, copy_constructor,
+                   move_constructor, project_name);
+    vector_methods(type_registry, c_tu, cpp_record, c_record);
+    string_table_method(type_registry, c_tu, cpp_record, c_record);
+
+    for (size_t i = decl_count; i < c_tu.decls.size(); ++i) {
+        const auto& node = c_tu.decls[i];
+        if (node->kind == NodeKind::Function && !node->private_) {
+            c_record.functions.push_back(node);
+        }
+    }
 
     // Conversions
-    record_conversions(c_tu, cpp_record, c_record, copy_constructor);
+    record_conversions(c_tu, cpp_record, c_record, copy_constructor,
+                       move_constructor);
 }
 
 //------------------------------------------------------------------------------
@@ -2137,10 +2886,10 @@ void translation_unit_entries(NodeId& new_id, TypeRegistry& type_registry,
     c_tu->private_header_filename =
         header_file_include(std::get<PrivateHeader>(filepaths));
     c_tu->include_paths = cpp_tu->include_paths;
-    c_tu->private_includes.insert("#include <cstring>");
 
     // source includes -> private includes, this is so we have the types
-    // we for other translation units
+    // we for other translation units. minimise_includes moves them on to the
+    // source if the private header turns out not to need them.
     auto cppmm_bind_h = std::string("cppmm_bind.hpp");
     for (auto& i : cpp_tu->source_includes) {
         auto use_include = pystring::find(i, cppmm_bind_h) == -1;
@@ -2195,17 +2944,18 @@ void translation_unit_entries(NodeId& new_id, TypeRegistry& type_registry,
 
 //------------------------------------------------------------------------------
 void translation_unit_details(TypeRegistry& type_registry, Root& root,
-                              const size_t cpp_tu_size, const size_t cpp_tu) {
+                              const size_t cpp_tu_size, const size_t cpp_tu,
+                              const std::string& project_name) {
     auto& c_tu = *root.tus[cpp_tu_size + cpp_tu];
 
     // cpp methods -> c functions
     for (const auto& node : root.tus[cpp_tu]->decls) {
         switch (node->kind) {
         case NodeKind::Record:
-            generate::record_detail(type_registry, c_tu, node);
+            generate::record_detail(type_registry, c_tu, node, project_name);
             break;
         case NodeKind::Function:
-            generate::function_detail(type_registry, c_tu, node);
+            generate::function_detail(type_registry, c_tu, node, project_name);
             break;
         default:
             break;
@@ -2213,15 +2963,52 @@ void translation_unit_details(TypeRegistry& type_registry, Root& root,
     }
 }
 
+//------------------------------------------------------------------------------
+// Once every translation unit is complete, drop the includes and forward
+// declarations its files don't need
+void minimise_includes(TranslationUnit& c_tu) {
+    // A record whose header is included anyway doesn't need declaring
+    for (auto it = c_tu.forward_decls.begin();
+         it != c_tu.forward_decls.end();) {
+        const auto& record = *static_cast<const NodeRecord*>(it->get());
+        const auto r_tu = record.tu.lock();
+        if (r_tu && c_tu.header_includes.count(r_tu->header_filename)) {
+            it = c_tu.forward_decls.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    // Only the casts and the inline conversions in the private header need
+    // the cpp types. Without them, the binding's includes are only needed
+    // by the source, and every other source including this private header
+    // is spared them.
+    if (!c_tu.casts.empty()) {
+        return;
+    }
+
+    for (const auto& node : c_tu.decls) {
+        if (node->kind == NodeKind::Function && node->private_) {
+            return;
+        }
+    }
+
+    c_tu.source_includes.insert(c_tu.private_includes.begin(),
+                                c_tu.private_includes.end());
+    c_tu.private_includes.clear();
+}
+
 } // namespace generate
 
 //------------------------------------------------------------------------------
-void add_c(const std::string& output_directory, Root& root) {
+void add_c(const std::string& project_name,
+           const std::string& output_directory, Root& root) {
     // For storing the mappings between cpp and c records
     auto type_registry = TypeRegistry();
 
     // The starting id for newly created records
     NodeId current_record_id = generate::find_record_id_upper_bound(root) + 1;
+    type_registry.reserve(current_record_id);
 
     // When we iterate we dont want to loop over newly added c translation units
     const auto tu_count = root.tus.size();
@@ -2232,7 +3019,12 @@ void add_c(const std::string& output_directory, Root& root) {
 
     // Implement the records
     for (size_t i = 0; i != tu_count; ++i) {
-        generate::translation_unit_details(type_registry, root, tu_count, i);
+        generate::translation_unit_details(type_registry, root, tu_count, i,
+                                           project_name);
+    }
+
+    for (size_t i = tu_count; i != root.tus.size(); ++i) {
+        generate::minimise_includes(*root.tus[i]);
     }
 }
 
@@ -9,6 +9,7 @@
 
 #include <iostream>
 #include <memory>
+#include <unordered_map>
 
 #define SPDLOG_ACTIVE_LEVEL TRACE
 
@@ -45,6 +46,7 @@ const char* COLLAPSE = "collapse";
 const char* COMMENT = "comment";
 const char* CONSTRUCTOR = "constructor";
 const char* COPY_CONSTRUCTOR = "copy_constructor";
+const char* MOVE_CONSTRUCTOR = "move_constructor";
 const char* CONST = "const";
 const char* DECLS = "decls";
 const char* ENUM_C = "Enum";
@@ -84,72 +86,199 @@ const char* OPAQUE_TYPE = "opaque_type";
 } // namespace
 
 //------------------------------------------------------------------------------
-NodeTypePtr read_type(const nln::json& json);
+// TypeKey
+//------------------------------------------------------------------------------
+// Everything that distinguishes one type node from another. Child types are
+// interned before their parents, so they can be compared by address.
+struct TypeKey {
+    NodeKind kind;
+    bool const_;
+    NodeId id;
+    // The pointer kind, the record, enum or typedef id, or the array size
+    uint64_t detail;
+    std::string type_name;
+    std::vector<const NodeType*> children;
+
+    bool operator==(const TypeKey& rhs) const {
+        return kind == rhs.kind && const_ == rhs.const_ && id == rhs.id &&
+               detail == rhs.detail && type_name == rhs.type_name &&
+               children == rhs.children;
+    }
+};
+
+struct TypeKeyHash {
+    size_t operator()(const TypeKey& key) const {
+        size_t result = std::hash<std::string>()(key.type_name);
+        const auto combine = [&result](size_t h) {
+            result ^= h + 0x9e3779b9 + (result << 6) + (result >> 2);
+        };
+        combine(static_cast<size_t>(key.kind));
+        combine(key.const_);
+        combine(key.id);
+        combine(key.detail);
+        for (const auto* c : key.children) {
+            combine(std::hash<const NodeType*>()(c));
+        }
+        return result;
+    }
+};
+
+//------------------------------------------------------------------------------
+// TypeTable
+//------------------------------------------------------------------------------
+// Hash-conses the type nodes, so that every occurrence of a type in the AST,
+// such as each "const float &" parameter, shares a single node. Nothing
+// modifies a type node once it has been read, which is what makes this safe.
+//
+// TODO: This only shares nodes at read time. The types add_c builds are still
+// one shared_ptr each, and every NodeTypePtr still costs a refcount. The plan
+// for index-addressed type storage, one step at a time:
+//   1. Move this table onto Root as the owner of every type node, and intern
+//      the types made by add_c (NodeBuiltinType::n and friends) through it.
+//   2. Add a 32-bit TypeId, an index into the table, and store TypeIds
+//      instead of NodeTypePtrs in the child types, Param, Field and
+//      NodeFunction, then in the expressions and typedefs.
+//   3. Key TypeKey on a Symbol for type_name and on child TypeIds instead
+//      of child addresses.
+//   4. Drop NodeTypePtr once nothing holds one, so types are only looked up
+//      through the table.
+class TypeTable {
+    // The unique nodes in the order they were first seen
+    std::vector<NodeTypePtr> m_types;
+    // Where each type's node is in m_types
+    std::unordered_map<TypeKey, size_t, TypeKeyHash> m_index;
+
+public:
+    // Return the node for key, calling make to create it only the first time
+    // the type is seen
+    template <typename F> NodeTypePtr intern(TypeKey&& key, F make) {
+        auto it = m_index.find(key);
+        if (it != m_index.end()) {
+            return m_types[it->second];
+        }
+
+        m_types.push_back(make());
+        m_index.emplace(std::move(key), m_types.size() - 1);
+        return m_types.back();
+    }
+
+    size_t size() const { return m_types.size(); }
+};
+
+//------------------------------------------------------------------------------
+NodeTypePtr read_type(TypeTable& types, const nln::json& json);
 
 //------------------------------------------------------------------------------
-NodeTypePtr read_type_builtin(const nln::json& json) {
-    return NodeBuiltinType::n("", json[ID].get<Id>(),
-                              json[TYPE].get<std::string>(),
-                              json[CONST].get<bool>());
+NodeTypePtr read_type_builtin(TypeTable& types, const nln::json& json) {
+    auto id = json[ID].get<Id>();
+    auto type_name = json[TYPE].get<std::string>();
+    auto const_ = json[CONST].get<bool>();
+
+    auto key = TypeKey{NodeKind::BuiltinType, const_, id, 0, type_name, {}};
+    return types.intern(std::move(key), [&] {
+        return NodeBuiltinType::n("", id, type_name, const_);
+    });
 }
 
 //------------------------------------------------------------------------------
-NodeTypePtr read_type_pointer(const nln::json& json, PointerKind pointer_kind) {
-    return NodePointerType::n(pointer_kind, read_type(json[POINTEE]),
-                              json[CONST].get<bool>());
+NodeTypePtr read_type_pointer(TypeTable& types, const nln::json& json,
+                              PointerKind pointer_kind) {
+    auto pointee_type = read_type(types, json[POINTEE]);
+    auto const_ = json[CONST].get<bool>();
+
+    auto key = TypeKey{NodeKind::PointerType,
+                       const_,
+                       0,
+                       static_cast<uint64_t>(pointer_kind),
+                       "",
+                       {pointee_type.get()}};
+    return types.intern(std::move(key), [&] {
+        return NodePointerType::n(pointer_kind, std::move(pointee_type),
+                                  const_);
+    });
 }
 
 //------------------------------------------------------------------------------
-NodeTypePtr read_type_record(const nln::json& json) {
-    return NodeRecordType::n(
-        "", json[ID].get<Id>(), json[TYPE].get<std::string>(),
-        json[RECORD_L].get<NodeId>(), json[CONST].get<bool>());
+NodeTypePtr read_type_record(TypeTable& types, const nln::json& json) {
+    auto id = json[ID].get<Id>();
+    auto type_name = json[TYPE].get<std::string>();
+    auto record = json[RECORD_L].get<NodeId>();
+    auto const_ = json[CONST].get<bool>();
+
+    auto key =
+        TypeKey{NodeKind::RecordType, const_, id, record, type_name, {}};
+    return types.intern(std::move(key), [&] {
+        return NodeRecordType::n("", id, type_name, record, const_);
+    });
 }
 
 //------------------------------------------------------------------------------
-NodeTypePtr read_type_enum(const nln::json& json) {
-    return NodeEnumType::n("", json[ID].get<Id>(),
-                           json[TYPE].get<std::string>(),
-                           json[ENUM_L].get<NodeId>(), json[CONST].get<bool>());
+NodeTypePtr read_type_enum(TypeTable& types, const nln::json& json) {
+    auto id = json[ID].get<Id>();
+    auto type_name = json[TYPE].get<std::string>();
+    auto enm = json[ENUM_L].get<NodeId>();
+    auto const_ = json[CONST].get<bool>();
+
+    auto key = TypeKey{NodeKind::EnumType, const_, id, enm, type_name, {}};
+    return types.intern(std::move(key), [&] {
+        return NodeEnumType::n("", id, type_name, enm, const_);
+    });
 }
 
 //------------------------------------------------------------------------------
-NodeTypePtr read_type_const_array(const nln::json& json) {
-    return NodeArrayType::n("", json[ID].get<NodeId>(),
-                            json[TYPE].get<std::string>(),
-                            read_type(json[ELEMENT_TYPE]),
-                            json[SIZE].get<int>(), json[CONST].get<bool>());
+NodeTypePtr read_type_const_array(TypeTable& types, const nln::json& json) {
+    auto id = json[ID].get<NodeId>();
+    auto type_name = json[TYPE].get<std::string>();
+    auto element_type = read_type(types, json[ELEMENT_TYPE]);
+    auto size = json[SIZE].get<int>();
+    auto const_ = json[CONST].get<bool>();
+
+    auto key = TypeKey{NodeKind::ArrayType,
+                       const_,
+                       id,
+                       static_cast<uint64_t>(size),
+                       type_name,
+                       {element_type.get()}};
+    return types.intern(std::move(key), [&] {
+        return NodeArrayType::n("", id, type_name, std::move(element_type),
+                                size, const_);
+    });
 }
 
 //------------------------------------------------------------------------------
-NodeTypePtr read_type_unknown(const nln::json& json) {
-    return NodeUnknownType::n(json[CONST].get<bool>());
+NodeTypePtr read_type_unknown(TypeTable& types, const nln::json& json) {
+    auto const_ = json[CONST].get<bool>();
+
+    auto key = TypeKey{NodeKind::UnknownType, const_, 0, 0, "", {}};
+    return types.intern(std::move(key),
+                        [&] { return NodeUnknownType::n(const_); });
 }
 
-NodeTypePtr read_type_function_proto(const nln::json& json);
+NodeTypePtr read_type_function_proto(TypeTable& types, const nln::json& json);
 
 //------------------------------------------------------------------------------
-NodeTypePtr read_type(const nln::json& json) {
+NodeTypePtr read_type(TypeTable& types, const nln::json& json) {
 
     auto kind_iter = json.find(KIND);
     if (kind_iter != json.end()) {
         auto kind = json[KIND].get<std::string>();
         if (kind == "BuiltinType") {
-            return read_type_builtin(json);
+            return read_type_builtin(types, json);
         } else if (kind == "RecordType") {
-            return read_type_record(json);
+            return read_type_record(types, json);
         } else if (kind == "Reference") {
-            return read_type_pointer(json, PointerKind::Reference);
+            return read_type_pointer(types, json, PointerKind::Reference);
         } else if (kind == "RValueReference") {
-            return read_type_pointer(json, PointerKind::RValueReference);
+            return read_type_pointer(types, json,
+                                     PointerKind::RValueReference);
         } else if (kind == "Pointer") {
-            return read_type_pointer(json, PointerKind::Pointer);
+            return read_type_pointer(types, json, PointerKind::Pointer);
         } else if (kind == "EnumType") {
-            return read_type_enum(json);
+            return read_type_enum(types, json);
         } else if (kind == "FunctionProtoType") {
-            return read_type_function_proto(json);
+            return read_type_function_proto(types, json);
         } else if (kind == "ConstantArrayType") {
-            return read_type_const_array(json);
+            return read_type_const_array(types, json);
         }
 
         SPDLOG_CRITICAL("Unhandled type kind {}", kind);
@@ -157,7 +286,7 @@ NodeTypePtr read_type(const nln::json& json) {
         auto type_iter = json.find(TYPE);
         if (type_iter != json.end() &&
             type_iter->get<std::string>() == "UNKNOWN") {
-            return read_type_unknown(json);
+            return read_type_unknown(types, json);
         } else {
             SPDLOG_CRITICAL("Could not find {} in json", TYPE);
         }
@@ -167,20 +296,20 @@ NodeTypePtr read_type(const nln::json& json) {
 }
 
 //------------------------------------------------------------------------------
-Param read_param(const nln::json& json) {
+Param read_param(TypeTable& types, const nln::json& json) {
 
     auto name = json[NAME].get<std::string>();
-    auto type = read_type(json[TYPE]);
+    auto type = read_type(types, json[TYPE]);
     auto index = json[INDEX].get<uint64_t>();
 
     return Param(std::move(name), std::move(type), index);
 }
 
 //------------------------------------------------------------------------------
-std::vector<std::string> read_attrs(const nln::json& json) {
-    auto attrs = std::vector<std::string>();
+std::vector<Symbol> read_attrs(const nln::json& json) {
+    auto attrs = std::vector<Symbol>();
     for (const auto& i : json[ATTRIBUTES]) {
-        attrs.push_back(i.get<std::string>());
+        attrs.push_back(Symbol(i.get<std::string>()));
     }
     return attrs;
 }
@@ -212,23 +341,33 @@ std::string read_comment(const nln::json& json) {
 }
 
 //------------------------------------------------------------------------------
-NodeTypePtr read_type_function_proto(const nln::json& json) {
-    auto return_type = read_type(json[RETURN]);
+NodeTypePtr read_type_function_proto(TypeTable& types, const nln::json& json) {
+    auto return_type = read_type(types, json[RETURN]);
 
     auto params = std::vector<NodeTypePtr>();
+    auto children = std::vector<const NodeType*>({return_type.get()});
     for (const auto& i : json[PARAMS]) {
-        auto p = read_param(i);
+        auto p = read_param(types, i);
+        children.push_back(p.type.get());
         params.push_back(std::move(p.type));
     }
 
-    return NodeFunctionProtoType::n(
-        std::move(return_type), std::move(params),
-        json[TYPE].get<std::string>(),
-        json[FUNCTION_POINTER_TYPEDEF_L].get<NodeId>());
+    auto type = json[TYPE].get<std::string>();
+    auto function_pointer_typedef =
+        json[FUNCTION_POINTER_TYPEDEF_L].get<NodeId>();
+
+    auto key = TypeKey{NodeKind::FunctionProtoType, false, 0,
+                       function_pointer_typedef, type, std::move(children)};
+    return types.intern(std::move(key), [&] {
+        return NodeFunctionProtoType::n(std::move(return_type),
+                                        std::move(params), type,
+                                        function_pointer_typedef);
+    });
 }
 
 //------------------------------------------------------------------------------
-NodePtr read_function(const TranslationUnit::Ptr& tu, const nln::json& json) {
+NodePtr read_function(TypeTable& types, const TranslationUnit::Ptr& tu,
+                      const nln::json& json) {
     // ignore for the moment
     auto attrs = read_attrs(json);
 
@@ -236,11 +375,11 @@ NodePtr read_function(const TranslationUnit::Ptr& tu, const nln::json& json) {
 
     auto short_name = json[SHORT_NAME].get<std::string>();
     auto id = json[ID].get<Id>();
-    auto return_type = read_type(json[RETURN]);
+    auto return_type = read_type(types, json[RETURN]);
 
     auto params = std::vector<Param>();
     for (const auto& i : json[PARAMS]) {
-        params.push_back(read_param(i));
+        params.push_back(read_param(types, i));
     }
 
     // Namespaces
@@ -253,7 +392,7 @@ NodePtr read_function(const TranslationUnit::Ptr& tu, const nln::json& json) {
 
     auto template_args = std::vector<NodeTypePtr>();
     for (const auto& i : json[TEMPLATE_ARGS]) {
-        auto typ = read_type(i[TYPE]);
+        auto typ = read_type(types, i[TYPE]);
         SPDLOG_DEBUG("Read template arg type {}", typ->type_name);
         template_args.push_back(typ);
     }
@@ -270,7 +409,7 @@ NodePtr read_function(const TranslationUnit::Ptr& tu, const nln::json& json) {
 }
 
 //------------------------------------------------------------------------------
-NodeMethod read_method(const nln::json& json) {
+NodeMethod read_method(TypeTable& types, const nln::json& json) {
 
     auto qualified_name = json[QUALIFIED_NAME].get<std::string>();
     auto attrs = read_attrs(json);
@@ -281,7 +420,8 @@ NodeMethod read_method(const nln::json& json) {
     auto constructor = json[CONSTRUCTOR].get<bool>();
     auto destructor = json[DESTRUCTOR].get<bool>();
     auto copy_constructor = json[COPY_CONSTRUCTOR].get<bool>();
-    auto return_type = read_type(json[RETURN]);
+    auto move_constructor = json[MOVE_CONSTRUCTOR].get<bool>();
+    auto return_type = read_type(types, json[RETURN]);
     auto const_ = json[CONST].get<bool>();
     auto comment = read_comment(json);
 
@@ -296,12 +436,12 @@ NodeMethod read_method(const nln::json& json) {
 
     auto params = std::vector<Param>();
     for (const auto& i : json[PARAMS]) {
-        params.push_back(read_param(i));
+        params.push_back(read_param(types, i));
     }
 
     auto template_args = std::vector<NodeTypePtr>();
     for (const auto& i : json[TEMPLATE_ARGS]) {
-        auto typ = read_type(i[TYPE]);
+        auto typ = read_type(types, i[TYPE]);
         SPDLOG_DEBUG("Read template arg type {}", typ->type_name);
         template_args.push_back(typ);
     }
@@ -310,21 +450,22 @@ NodeMethod read_method(const nln::json& json) {
 
     return NodeMethod(qualified_name, id, attrs, short_name,
                       std::move(return_type), std::move(params), static_,
-                      constructor, copy_constructor, destructor, const_,
-                      std::move(comment), std::move(template_args),
-                      std::move(exceptions));
+                      constructor, copy_constructor, move_constructor,
+                      destructor, const_, std::move(comment),
+                      std::move(template_args), std::move(exceptions));
 }
 
 //------------------------------------------------------------------------------
-Field read_field(const nln::json& json) {
+Field read_field(TypeTable& types, const nln::json& json) {
     return Field{
         std::move(json[NAME].get<std::string>()),
-        std::move(read_type(json[TYPE])),
+        std::move(read_type(types, json[TYPE])),
     };
 }
 
 //------------------------------------------------------------------------------
-NodePtr read_record(const TranslationUnit::Ptr& tu, const nln::json& json) {
+NodePtr read_record(TypeTable& types, const TranslationUnit::Ptr& tu,
+                    const nln::json& json) {
     // Dont ignore these
     Id id = json[ID].get<Id>();
     auto size = json[SIZE].get<uint64_t>();
@@ -371,7 +512,7 @@ NodePtr read_record(const TranslationUnit::Ptr& tu, const nln::json& json) {
     }
 
     // Pull out the attributes
-    std::vector<std::string> attrs = read_attrs(json);
+    std::vector<Symbol> attrs = read_attrs(json);
 
     // Read the comment
     auto comment = read_comment(json);
@@ -383,12 +524,12 @@ NodePtr read_record(const TranslationUnit::Ptr& tu, const nln::json& json) {
 
     // Pull out the methods
     for (const auto& i : json[METHODS]) {
-        result->methods.push_back(read_method(i));
+        result->methods.push_back(read_method(types, i));
     }
 
     // Pull out the fields
     for (const auto& i : json[FIELDS]) {
-        result->fields.push_back(std::move(read_field(i)));
+        result->fields.push_back(std::move(read_field(types, i)));
     }
 
     // Return the result
@@ -415,7 +556,7 @@ NodePtr read_enum(const TranslationUnit::Ptr& tu, const nln::json& json) {
         namespaces.push_back(ns);
     }
 
-    std::vector<std::string> attrs = read_attrs(json);
+    std::vector<Symbol> attrs = read_attrs(json);
 
     // Pull out the variants
     std::vector<std::pair<std::string, std::string>> variants;
@@ -440,14 +581,15 @@ NodePtr read_enum(const TranslationUnit::Ptr& tu, const nln::json& json) {
 }
 
 //------------------------------------------------------------------------------
-NodePtr read_var(const TranslationUnit::Ptr& tu, const nln::json& json) {
+NodePtr read_var(TypeTable& types, const TranslationUnit::Ptr& tu,
+                 const nln::json& json) {
     // Ignore these for the moment
     std::vector<std::string> _attrs;
 
     // Dont ignore these
     auto name = json[SHORT_NAME].get<std::string>();
     // std::cout << "read type" << std::endl;
-    auto type = read_type(json[TYPE]);
+    auto type = read_type(types, json[TYPE]);
 
     // Instantiate the translation unit
     auto result = NodeVarDeclExpr::n(type, name);
@@ -475,7 +617,8 @@ NodePtr read_namespace(const TranslationUnit::Ptr& tu, const nln::json& json) {
 }
 
 //------------------------------------------------------------------------------
-NodePtr read_function_pointer_typedef(const TranslationUnit::Ptr& tu,
+NodePtr read_function_pointer_typedef(TypeTable& types,
+                                      const TranslationUnit::Ptr& tu,
                                       const nln::json& json) {
     // Ignore these for the moment
     std::vector<std::string> _attrs;
@@ -492,11 +635,11 @@ NodePtr read_function_pointer_typedef(const TranslationUnit::Ptr& tu,
 
     auto comment = read_comment(json);
 
-    auto return_type = read_type(json[RETURN]);
+    auto return_type = read_type(types, json[RETURN]);
 
     auto params = std::vector<Param>();
     for (const auto& i : json[PARAMS]) {
-        params.push_back(read_param(i));
+        params.push_back(read_param(types, i));
     }
 
     auto result = NodeFunctionPointerTypedef::n(
@@ -508,21 +651,22 @@ NodePtr read_function_pointer_typedef(const TranslationUnit::Ptr& tu,
 }
 
 //------------------------------------------------------------------------------
-NodePtr read_node(const TranslationUnit::Ptr& tu, const nln::json& json) {
+NodePtr read_node(TypeTable& types, const TranslationUnit::Ptr& tu,
+                  const nln::json& json) {
     auto kind = json[KIND].get<std::string>();
 
     if (kind == RECORD_C) {
-        return read_record(tu, json);
+        return read_record(types, tu, json);
     } else if (kind == ENUM_C) {
         return read_enum(tu, json);
     } else if (kind == FUNCTION_C) {
-        return read_function(tu, json);
+        return read_function(types, tu, json);
     } else if (kind == NAMESPACE_C) {
         return read_namespace(tu, json);
     } else if (kind == VAR_C) {
-        return read_var(tu, json);
+        return read_var(types, tu, json);
     } else if (kind == FUNCTION_POINTER_TYPEDEF_C) {
-        return read_function_pointer_typedef(tu, json);
+        return read_function_pointer_typedef(types, tu, json);
     }
 
     panic("Unhandled node kind {}", kind);
@@ -531,7 +675,8 @@ NodePtr read_node(const TranslationUnit::Ptr& tu, const nln::json& json) {
 }
 
 //------------------------------------------------------------------------------
-TranslationUnit::Ptr read_translation_unit(const nln::json& json) {
+TranslationUnit::Ptr read_translation_unit(TypeTable& types,
+                                          const nln::json& json) {
     // Read the translation unit
     auto filename = json[FILENAME].get<std::string>();
 
@@ -550,7 +695,7 @@ TranslationUnit::Ptr read_translation_unit(const nln::json& json) {
 
     // Parse the elements of the translation unit
     for (const auto& i : json[DECLS]) {
-        result->decls.push_back(read_node(result, i));
+        result->decls.push_back(read_node(types, result, i));
     }
 
     // Return the result
@@ -561,6 +706,7 @@ TranslationUnit::Ptr read_translation_unit(const nln::json& json) {
 Root json(const std::string& input_directory) {
 
     std::vector<TranslationUnit::Ptr> tus;
+    TypeTable types;
 
     for (const auto& p : fs::directory_iterator(input_directory)) {
         if (p.path().extension() == ".json") {
@@ -573,10 +719,12 @@ Root json(const std::string& input_directory) {
             input_file >> json;
 
             // Later this can be a loop taking in multiple translation units
-            tus.push_back(read_translation_unit(json));
+            tus.push_back(read_translation_unit(types, json));
         }
     }
 
+    SPDLOG_DEBUG("Read {} unique types", types.size());
+
     return Root(std::move(tus));
 }
 
@@ -9,7 +9,12 @@
 
 #include <fmt/os.h>
 
+#include <algorithm>
+#include <cctype>
 #include <iostream>
+#include <map>
+#include <set>
+#include <unordered_map>
 
 #include "filesystem.hpp"
 namespace fs = ghc::filesystem;
@@ -58,6 +63,17 @@ std::string compute_c_header_path(const std::string& path,
     return result;
 }
 
+//------------------------------------------------------------------------------
+std::string compute_export_macro(const char* project_name) {
+    std::string result;
+    for (const char* c = project_name; *c; ++c) {
+        result += std::isalnum(*c) ? std::toupper(*c) : '_';
+    }
+    result += "_EXPORT";
+
+    return result;
+}
+
 std::string convert_param(const NodeTypePtr& field, const std::string& name);
 
 //------------------------------------------------------------------------------
@@ -84,6 +100,8 @@ std::string convert_pointer_param(const NodeTypePtr& t,
         return convert_param(p->pointee_type, fmt::format("* {}", name));
     case PointerKind::Reference:
         return convert_param(p->pointee_type, fmt::format("& {}", name));
+    case PointerKind::RValueReference:
+        return convert_param(p->pointee_type, fmt::format("&& {}", name));
     default:
         break;
     }
@@ -166,6 +184,22 @@ void write_record(fmt::ostream& out, const NodePtr& node) {
     if (record.name != record.nice_name) {
         out.print("typedef {} {};\n\n", record.name, record.nice_name);
     }
+
+    // Opaque pointer records can still be constructed in place, as long as
+    // the caller knows how much storage to give them
+    if (bind_type(record) == BindType::OpaquePtr && !record.opaque_type) {
+        const auto prefix = pystring::slice(record.name, 0, -2);
+        const auto nice_prefix = pystring::slice(record.nice_name, 0, -2);
+        out.print("#define {}_sizeof {}\n", prefix,
+                  record.size / sizeof_byte);
+        out.print("#define {}_alignof {}\n", prefix, align_in_bytes);
+        if (prefix != nice_prefix) {
+            out.print("#define {0}_sizeof {1}_sizeof\n", nice_prefix, prefix);
+            out.print("#define {0}_alignof {1}_alignof\n", nice_prefix,
+                      prefix);
+        }
+        out.print("\n");
+    }
 }
 
 //------------------------------------------------------------------------------
@@ -236,16 +270,62 @@ void write_function_pointer_typedef(fmt::ostream& out, const NodePtr& node) {
 }
 
 //------------------------------------------------------------------------------
-void write_function_dcl(fmt::ostream& out, const NodePtr& node, Access access) {
+// Write a callable that forwards to a function pointer and its user data, so
+// C callbacks can be handed to C++ APIs taking a callable. It's only two
+// pointers, which std::function stores inline without allocating.
+void write_function_pointer_trampoline(fmt::ostream& out, const NodePtr& node) {
+    const NodeFunctionPointerTypedef& fpt =
+        *static_cast<const NodeFunctionPointerTypedef*>(node.get());
+
+    const int user_data = find_user_data_param(fpt);
+    if (user_data == -1) {
+        return;
+    }
+
+    std::vector<std::string> params;
+    std::vector<std::string> args;
+    for (size_t i = 0; i < fpt.params.size(); ++i) {
+        if (int(i) == user_data) {
+            args.push_back("user_data");
+        } else {
+            auto name = fmt::format("a{}", i);
+            params.push_back(convert_param(fpt.params[i].type, name));
+            args.push_back(name);
+        }
+    }
+
+    out.print("struct {}_fn {{\n", pystring::slice(fpt.nice_name, 0, -2));
+    indent(out, 1);
+    out.print("{} fn;\n", fpt.nice_name);
+    indent(out, 1);
+    out.print("void * user_data;\n\n");
+    indent(out, 1);
+    out.print("{}operator()({}) const {{\n",
+              convert_param(fpt.return_type, ""), pystring::join(", ", params));
+    indent(out, 2);
+    out.print("return fn({});\n", pystring::join(", ", args));
+    indent(out, 1);
+    out.print("}}\n}};\n\n");
+}
+
+//------------------------------------------------------------------------------
+void write_function_dcl(fmt::ostream& out, const NodePtr& node, Access access,
+                        const std::string& export_macro) {
     const NodeFunction& function =
         *static_cast<const NodeFunction*>(node.get());
 
-    if (!function.comment.empty()) {
-        auto comment = function.comment;
-        out.print("/** {} */\n", comment);
-    }
     const bool private_ = (access == Access::Private);
     if (private_ == function.private_) {
+        if (!function.comment.empty()) {
+            auto comment = function.comment;
+            out.print("/** {} */\n", comment);
+        }
+
+        // Only the public wrappers are exported from the shared library, the
+        // private helpers stay hidden
+        if (!private_ && !export_macro.empty()) {
+            out.print("{} ", export_macro);
+        }
         out.print("{}(", convert_param(function.return_type, function.name));
         write_params(out, function);
         out.print(");\n");
@@ -455,7 +535,11 @@ void write_expression_block(fmt::ostream& out, size_t depth,
     for (auto& i : block_expr.expressions) {
         indent(out, depth);
         write_expression(out, depth + 1, i);
-        out.print(";\n");
+        if (i->kind == NodeKind::ForExpr) {
+            out.print("\n");
+        } else {
+            out.print(";\n");
+        }
     }
 }
 
@@ -469,6 +553,19 @@ void write_expression_assign(fmt::ostream& out, size_t depth,
     write_expression(out, depth + 1, assign_expr.rhs);
 }
 
+//------------------------------------------------------------------------------
+void write_expression_for(fmt::ostream& out, size_t depth,
+                          const NodeExprPtr& node) {
+    const auto& for_expr = *static_cast<const NodeForExpr*>(node.get());
+
+    out.print("for (size_t {0} = 0; {0} < ", for_expr.index);
+    write_expression(out, depth, for_expr.count);
+    out.print("; ++{}) {{\n", for_expr.index);
+    write_expression(out, depth, for_expr.body);
+    indent(out, depth - 1);
+    out.print("}}");
+}
+
 //------------------------------------------------------------------------------
 void write_expression(fmt::ostream& out, size_t depth,
                       const NodeExprPtr& node) {
@@ -506,6 +603,8 @@ void write_expression(fmt::ostream& out, size_t depth,
         return write_expression_assign(out, depth, node);
     case NodeKind::InfixOperatorExpr:
         return write_expression_infix_operator(out, depth, node);
+    case NodeKind::ForExpr:
+        return write_expression_for(out, depth, node);
     default:
         break;
     }
@@ -514,7 +613,8 @@ void write_expression(fmt::ostream& out, size_t depth,
 }
 
 //------------------------------------------------------------------------------
-void write_function_bdy(fmt::ostream& out, const NodePtr& node, Access access) {
+void write_function_bdy(fmt::ostream& out, const NodePtr& node, Access access,
+                        bool exceptions) {
     const NodeFunction& function =
         *static_cast<const NodeFunction*>(node.get());
 
@@ -529,24 +629,29 @@ void write_function_bdy(fmt::ostream& out, const NodePtr& node, Access access) {
         out.print(")\n");
         out.print("{{\n");
 
+        if (function.stats_id != -1) {
+            out.print("    TLG_STATS_PROBE({});\n", function.stats_id);
+        }
+
         // FIXME AL: taking a shortcut here. We need to express this in terms
         // of expression nodes, but let's get it working first
-        if (!function.private_) {
+        const bool catch_exceptions = exceptions && !function.private_;
+        if (catch_exceptions) {
             out.print("    try {{\n");
         }
 
         write_expression(out, 2, function.body);
 
-        if (!function.private_) {
+        if (catch_exceptions) {
             for (const auto& e : function.exceptions) {
                 out.print("    }} catch ({}& e) {{\n"
-                          "        TLG_EXCEPTION_STRING = e.what();\n"
+                          "        tlg_set_exception_string(e.what());\n"
                           "        return {};\n",
                           e.cpp_name, e.error_code);
             }
 
             out.print("    }} catch (std::exception& e) {{\n"
-                      "        TLG_EXCEPTION_STRING = e.what();\n"
+                      "        tlg_set_exception_string(e.what());\n"
                       "        return -1;\n"
                       "    }}\n");
         }
@@ -557,14 +662,15 @@ void write_function_bdy(fmt::ostream& out, const NodePtr& node, Access access) {
 
 //------------------------------------------------------------------------------
 void write_function(fmt::ostream& out, const NodePtr& node, Access access,
-                    Place place) {
+                    Place place, const std::string& export_macro = "",
+                    bool exceptions = true) {
     const NodeFunction& function =
         *static_cast<const NodeFunction*>(node.get());
 
     if (function.inline_) {
         switch (place) {
         case Place::Header:
-            write_function_bdy(out, node, access);
+            write_function_bdy(out, node, access, exceptions);
             write_function_define(out, node, access);
             return;
         default:
@@ -573,11 +679,11 @@ void write_function(fmt::ostream& out, const NodePtr& node, Access access,
     } else {
         switch (place) {
         case Place::Header:
-            write_function_dcl(out, node, access);
+            write_function_dcl(out, node, access, export_macro);
             write_function_define(out, node, access);
             return;
         case Place::Source:
-            write_function_bdy(out, node, access);
+            write_function_bdy(out, node, access, exceptions);
             return;
         }
     }
@@ -635,6 +741,24 @@ void write_private_header(const TranslationUnit& tu) {
 
     out.print("\n");
 
+    // Pair each record's c type with its cpp type for the casts
+    if (!tu.casts.empty()) {
+        out.print("namespace cppmm {{\n");
+        for (const auto& cast : tu.casts) {
+            out.print("template <> struct cast_from_c<{0}> : cast<{0}, {1}> "
+                      "{{}};\n",
+                      cast.first, cast.second);
+        }
+        out.print("}} // namespace cppmm\n\n");
+    }
+
+    // And the callables for passing function pointers into C++
+    for (const auto& node : tu.decls) {
+        if (node->kind == NodeKind::FunctionPointerTypedef) {
+            write_function_pointer_trampoline(out, node);
+        }
+    }
+
     // Then all the private functions
     for (const auto& node : tu.decls) {
         if (node->kind == NodeKind::Function) {
@@ -645,7 +769,8 @@ void write_private_header(const TranslationUnit& tu) {
 }
 
 //------------------------------------------------------------------------------
-void write_header(const TranslationUnit& tu) {
+void write_header(const TranslationUnit& tu, const std::string& export_macro,
+                  bool exceptions) {
     auto out = fmt::output_file(compute_c_header_path(tu.filename, ".h"));
 
     out.print("#pragma once\n");
@@ -656,15 +781,21 @@ void write_header(const TranslationUnit& tu) {
     // Extern "C"
     out.print("#ifdef __cplusplus\nextern \"C\" {{\n#endif\n\n");
 
-    // Write out all the forward declarations
-    bool wrote_any = false;
+    // Write out all the forward declarations, by name rather than in the
+    // pointer order of the set so the output doesn't change from run to run
+    std::map<std::string, NodePtr> forward_decls;
     for (const auto& node : tu.forward_decls) {
         if (node->kind == NodeKind::Record) {
-            write_record_forward_decl(out, node);
-            wrote_any = true;
+            forward_decls.emplace(node->name, node);
         }
     }
 
+    bool wrote_any = false;
+    for (const auto& i : forward_decls) {
+        write_record_forward_decl(out, i.second);
+        wrote_any = true;
+    }
+
     if (wrote_any) {
         out.print("\n");
     }
@@ -713,7 +844,8 @@ void write_header(const TranslationUnit& tu) {
     for (const auto& node : tu.decls) {
         if (node->kind == NodeKind::Function) {
             out.print("\n");
-            write_function(out, node, Access::Public, Place::Header);
+            write_function(out, node, Access::Public, Place::Header,
+                           export_macro, exceptions);
             wrote_any = true;
         }
     }
@@ -723,7 +855,335 @@ void write_header(const TranslationUnit& tu) {
 }
 
 //------------------------------------------------------------------------------
-void write_source(const TranslationUnit& tu) {
+// Split headers
+//------------------------------------------------------------------------------
+
+// With --split-headers every public record, enum and function pointer typedef
+// also gets a header of its own, and each translation unit header just
+// includes the ones for its types. The headers are found by c type name.
+struct SplitHeaders {
+    struct Entry {
+        std::string include;
+        NodePtr node;
+    };
+
+    // The directory the headers are written to, and its name as included
+    std::string dir;
+    std::string include_dir;
+    std::unordered_map<std::string, Entry> entries;
+    // The translation unit headers, which the split headers never include
+    std::set<std::string> tu_headers;
+};
+
+// The includes and forward declarations one split header needs. The forward
+// declarations are keyed by c type name so they're written in a stable order.
+struct SplitDeps {
+    std::set<std::string> includes;
+    std::map<std::string, NodePtr> forward_decls;
+};
+
+//------------------------------------------------------------------------------
+// The c type name of a node that gets a split header, or an empty string
+std::string split_type_name(const NodePtr& node) {
+    switch (node->kind) {
+    case NodeKind::Record:
+        if (node->private_) {
+            return std::string();
+        }
+        return static_cast<const NodeRecord&>(*node).nice_name;
+    case NodeKind::Enum:
+        return static_cast<const NodeEnum&>(*node).nice_name;
+    case NodeKind::FunctionPointerTypedef:
+        return static_cast<const NodeFunctionPointerTypedef&>(*node).nice_name;
+    default:
+        return std::string();
+    }
+}
+
+//------------------------------------------------------------------------------
+SplitHeaders build_split_headers(const Root& root, size_t starting_point,
+                                 const char* base_project_name) {
+    SplitHeaders split;
+    split.include_dir = base_project_name;
+    split.dir = pystring::os::path::join(
+        pystring::os::path::dirname(root.tus[starting_point]->filename),
+        split.include_dir);
+
+    for (size_t i = starting_point; i < root.tus.size(); ++i) {
+        const auto& tu = *root.tus[i];
+        split.tu_headers.insert(tu.header_filename);
+
+        for (const auto& node : tu.decls) {
+            const auto type_name = split_type_name(node);
+            if (!type_name.empty()) {
+                split.entries[type_name] = SplitHeaders::Entry{
+                    fmt::format("#include <{}/{}.h>", split.include_dir,
+                                type_name),
+                    node};
+            }
+        }
+    }
+
+    return split;
+}
+
+//------------------------------------------------------------------------------
+// Records that are only pointed to just need declaring. Anything else, and
+// enums and function pointers wherever they are used, needs its header.
+void collect_split_deps(const SplitHeaders& split, const NodeTypePtr& t,
+                        bool pointee, SplitDeps& deps) {
+    if (!t) {
+        return;
+    }
+
+    const SplitHeaders::Entry* entry = nullptr;
+    switch (t->kind) {
+    case NodeKind::BuiltinType:
+        if (t->type_name == "_Bool") {
+            deps.includes.insert("#include <stdbool.h>");
+        } else if (t->type_name == "size_t") {
+            deps.includes.insert("#include <stddef.h>");
+        }
+        return;
+    case NodeKind::RecordType: {
+        auto it = split.entries.find(t->type_name);
+        if (it == split.entries.end()) {
+            return;
+        }
+        entry = &it->second;
+        break;
+    }
+    case NodeKind::PointerType:
+        collect_split_deps(
+            split, static_cast<const NodePointerType&>(*t).pointee_type, true,
+            deps);
+        return;
+    case NodeKind::ArrayType:
+        collect_split_deps(split,
+                           static_cast<const NodeArrayType&>(*t).element_type,
+                           pointee, deps);
+        return;
+    case NodeKind::FunctionProtoType: {
+        const auto& fpt = static_cast<const NodeFunctionProtoType&>(*t);
+        auto it = split.entries.find(fpt.type);
+        if (it == split.entries.end()) {
+            return;
+        }
+        entry = &it->second;
+        break;
+    }
+    default:
+        return;
+    }
+
+    if (pointee && entry->node->kind == NodeKind::Record) {
+        deps.forward_decls.emplace(t->type_name, entry->node);
+    } else {
+        deps.includes.insert(entry->include);
+    }
+}
+
+//------------------------------------------------------------------------------
+void collect_split_deps(const SplitHeaders& split, const NodeFunction& function,
+                        SplitDeps& deps) {
+    collect_split_deps(split, function.return_type, false, deps);
+    for (const auto& p : function.params) {
+        collect_split_deps(split, p.type, false, deps);
+    }
+}
+
+//------------------------------------------------------------------------------
+// The export header and the other helpers the translation unit's functions use
+void collect_helper_includes(const SplitHeaders& split,
+                             const TranslationUnit& tu, SplitDeps& deps) {
+    for (const auto& i : tu.header_includes) {
+        if (!split.tu_headers.count(i)) {
+            deps.includes.insert(i);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+template <typename F>
+void write_split_header(const SplitHeaders& split, const std::string& path,
+                        const SplitDeps& deps, F write_body) {
+    auto out = fmt::output_file(path);
+
+    out.print("#pragma once\n");
+    for (const auto& i : deps.includes) {
+        out.print("{}\n", i);
+    }
+
+    out.print("\n#ifdef __cplusplus\nextern \"C\" {{\n#endif\n\n");
+
+    // Records whose header is included anyway don't need declaring
+    bool wrote_any = false;
+    for (const auto& i : deps.forward_decls) {
+        if (!deps.includes.count(split.entries.at(i.first).include)) {
+            write_record_forward_decl(out, i.second);
+            wrote_any = true;
+        }
+    }
+
+    if (wrote_any) {
+        out.print("\n");
+    }
+
+    write_body(out);
+
+    out.print("#ifdef __cplusplus\n}}\n#endif\n");
+}
+
+//------------------------------------------------------------------------------
+std::string split_header_path(const SplitHeaders& split,
+                              const std::string& type_name) {
+    return pystring::os::path::join(split.dir, type_name + ".h");
+}
+
+//------------------------------------------------------------------------------
+void write_split_record_header(const SplitHeaders& split,
+                               const TranslationUnit& tu, const NodePtr& node,
+                               const std::string& export_macro,
+                               bool exceptions) {
+    const auto& record = static_cast<const NodeRecord&>(*node);
+
+    SplitDeps deps;
+    collect_helper_includes(split, tu, deps);
+    if (!record.opaque_type) {
+        for (const auto& field : record.fields) {
+            collect_split_deps(split, field.type, false, deps);
+        }
+    }
+    for (const auto& function : record.functions) {
+        collect_split_deps(split, static_cast<const NodeFunction&>(*function),
+                           deps);
+    }
+
+    // A record's methods take pointers to it
+    deps.forward_decls.erase(record.nice_name);
+
+    write_split_header(
+        split, split_header_path(split, record.nice_name), deps,
+        [&](fmt::ostream& out) {
+            write_record(out, node);
+            for (const auto& function : record.functions) {
+                out.print("\n");
+                write_function(out, function, Access::Public, Place::Header,
+                               export_macro, exceptions);
+            }
+            out.print("\n");
+        });
+}
+
+//------------------------------------------------------------------------------
+void write_split_enum_header(const SplitHeaders& split,
+                             const TranslationUnit& tu, const NodePtr& node) {
+    const auto& enum_ = static_cast<const NodeEnum&>(*node);
+
+    write_split_header(
+        split, split_header_path(split, enum_.nice_name), SplitDeps(),
+        [&](fmt::ostream& out) {
+            write_enum(out, node);
+            for (const auto& typedef_ : tu.decls) {
+                if (typedef_->kind == NodeKind::Typedef &&
+                    typedef_->name == enum_.nice_name) {
+                    write_typedef(out, typedef_);
+                }
+            }
+            out.print("\n");
+        });
+}
+
+//------------------------------------------------------------------------------
+void write_split_function_pointer_header(const SplitHeaders& split,
+                                         const NodePtr& node) {
+    const auto& fpt = static_cast<const NodeFunctionPointerTypedef&>(*node);
+
+    SplitDeps deps;
+    collect_split_deps(split, fpt.return_type, false, deps);
+    for (const auto& p : fpt.params) {
+        collect_split_deps(split, p.type, false, deps);
+    }
+
+    write_split_header(split, split_header_path(split, fpt.nice_name), deps,
+                       [&](fmt::ostream& out) {
+                           write_function_pointer_typedef(out, node);
+                           out.print("\n\n");
+                       });
+}
+
+//------------------------------------------------------------------------------
+// The translation unit header includes the headers of its own types, and
+// declares the functions that aren't methods of any of them
+void write_split_translation_unit(const SplitHeaders& split,
+                                  const TranslationUnit& tu,
+                                  const std::string& export_macro,
+                                  bool exceptions) {
+    SplitDeps deps;
+    collect_helper_includes(split, tu, deps);
+
+    std::set<const Node*> methods;
+    for (const auto& node : tu.decls) {
+        const auto it = split.entries.find(split_type_name(node));
+        if (it == split.entries.end() || it->second.node != node) {
+            continue;
+        }
+
+        deps.includes.insert(it->second.include);
+
+        switch (node->kind) {
+        case NodeKind::Record:
+            for (const auto& function :
+                 static_cast<const NodeRecord&>(*node).functions) {
+                methods.insert(function.get());
+            }
+            write_split_record_header(split, tu, node, export_macro,
+                                      exceptions);
+            break;
+        case NodeKind::Enum:
+            write_split_enum_header(split, tu, node);
+            break;
+        default:
+            write_split_function_pointer_header(split, node);
+            break;
+        }
+    }
+
+    std::vector<NodePtr> functions;
+    for (const auto& node : tu.decls) {
+        if (node->kind == NodeKind::Function && !node->private_ &&
+            !methods.count(node.get())) {
+            collect_split_deps(split, static_cast<const NodeFunction&>(*node),
+                               deps);
+            functions.push_back(node);
+        }
+    }
+
+    write_split_header(split, compute_c_header_path(tu.filename, ".h"), deps,
+                       [&](fmt::ostream& out) {
+                           for (const auto& node : functions) {
+                               out.print("\n");
+                               write_function(out, node, Access::Public,
+                                              Place::Header, export_macro,
+                                              exceptions);
+                           }
+                       });
+}
+
+//------------------------------------------------------------------------------
+// Includes every translation unit header, for consumers that want everything
+void write_split_umbrella_header(const SplitHeaders& split, const Root& root,
+                                 size_t starting_point) {
+    auto out = fmt::output_file(split_header_path(split, split.include_dir));
+
+    out.print("#pragma once\n");
+    for (size_t i = starting_point; i < root.tus.size(); ++i) {
+        out.print("{}\n", root.tus[i]->header_filename);
+    }
+}
+
+//------------------------------------------------------------------------------
+void write_source(const TranslationUnit& tu, bool exceptions) {
     auto out = fmt::output_file(tu.filename);
 
     // Write out the source includes
@@ -734,47 +1194,80 @@ void write_source(const TranslationUnit& tu) {
     // Write out the function definitions
     for (const auto& node : tu.decls) {
         if (node->kind == NodeKind::Function) {
-            write_function(out, node, Access::Public, Place::Source);
+            write_function(out, node, Access::Public, Place::Source, "",
+                           exceptions);
         }
     }
 }
 
 //------------------------------------------------------------------------------
-void write_translation_unit(const TranslationUnit& tu) {
-    write_header(tu);
+void write_translation_unit(const TranslationUnit& tu,
+                            const std::string& export_macro, bool exceptions,
+                            const SplitHeaders* split) {
+    if (split) {
+        write_split_translation_unit(*split, tu, export_macro, exceptions);
+    } else {
+        write_header(tu, export_macro, exceptions);
+    }
     write_private_header(tu);
-    write_source(tu);
+    write_source(tu, exceptions);
 }
 
 //------------------------------------------------------------------------------
-void c(const char* project_name, const Root& root, size_t starting_point) {
+void c(const char* project_name, const Root& root, size_t starting_point,
+       const char* base_project_name, bool exceptions, bool split_headers) {
     expect(starting_point < root.tus.size(),
            "starting point ({}) is out of range ({})", starting_point,
            root.tus.size());
 
+    const auto export_macro = compute_export_macro(base_project_name);
+
+    SplitHeaders split;
+    if (split_headers) {
+        split = build_split_headers(root, starting_point, base_project_name);
+        fs::create_directories(split.dir);
+        write_split_umbrella_header(split, root, starting_point);
+    }
+
     const auto size = root.tus.size();
     for (size_t i = starting_point; i < size; ++i) {
         const auto& tu = root.tus[i];
-        write_translation_unit(*tu);
+        write_translation_unit(*tu, export_macro, exceptions,
+                               split_headers ? &split : nullptr);
     }
 }
 
 //------------------------------------------------------------------------------
-void write_error_header(const char* filename, const char* project_name) {
+void write_export_header(const char* filename, const char* project_name) {
+    auto out = fmt::output_file(filename);
+
+    out.print(R"(#pragma once
+
+#ifndef {0}
+#define {0} __attribute__((visibility("default")))
+#endif
+)",
+              compute_export_macro(project_name));
+}
+
+//------------------------------------------------------------------------------
+void write_error_header(const char* filename, const char* export_header,
+                        const char* project_name) {
     auto out = fmt::output_file(filename);
 
     out.print(R"(#pragma once
+#include "{2}"
 #ifdef __cplusplus
 extern "C" {{
 #endif
 
-const char* {}_get_exception_string();
+{1} const char* {0}_get_exception_string();
 
 #ifdef __cplusplus
 }}
 #endif
 )",
-              project_name);
+              project_name, compute_export_macro(project_name), export_header);
 }
 
 //------------------------------------------------------------------------------
@@ -782,9 +1275,33 @@ void write_error_header_private(const char* filename,
                                 const char* project_name) {
     auto out = fmt::output_file(filename);
 
+    // The message buffer is a plain, fixed-size array in initial-exec TLS so
+    // that reporting an exception neither allocates nor goes through
+    // __tls_get_addr. Static TLS is scarce for dlopen'ed libraries, so keep
+    // the buffer small and truncate long messages.
     out.print(R"(#pragma once
-#include <string>
-extern thread_local std::string TLG_EXCEPTION_STRING;
+#include <cstddef>
+#include <cstring>
+
+#ifndef TLG_EXCEPTION_STRING_SIZE
+#define TLG_EXCEPTION_STRING_SIZE 256
+#endif
+
+extern thread_local char TLG_EXCEPTION_STRING[TLG_EXCEPTION_STRING_SIZE]
+    __attribute__((tls_model("initial-exec")));
+
+inline void tlg_set_exception_string(const char* what) {{
+    size_t len = std::strlen(what);
+    if (len >= TLG_EXCEPTION_STRING_SIZE) {{
+        len = TLG_EXCEPTION_STRING_SIZE - 1;
+        // Don't cut a UTF-8 sequence in half
+        while (len > 0 && (what[len] & 0xC0) == 0x80) {{
+            --len;
+        }}
+    }}
+    std::memcpy(TLG_EXCEPTION_STRING, what, len);
+    TLG_EXCEPTION_STRING[len] = '\0';
+}}
 )",
               project_name);
 }
@@ -797,10 +1314,11 @@ void write_error_source(const char* filename, const char* public_header,
     out.print(R"(#include "{0}"
 #include "{1}"
 
-thread_local std::string TLG_EXCEPTION_STRING;
+thread_local char TLG_EXCEPTION_STRING[TLG_EXCEPTION_STRING_SIZE]
+    __attribute__((tls_model("initial-exec")));
 
 const char* {2}_get_exception_string() {{
-    return TLG_EXCEPTION_STRING.c_str();
+    return TLG_EXCEPTION_STRING;
 }}
 
 )",
@@ -815,12 +1333,17 @@ void cerrors(const char* output_dir, Root& root, size_t starting_point,
     auto private_header_fn =
         fs::path(fmt::format("{}-errors-private.h", project_name));
     auto source_fn = fs::path(basename).replace_extension(".cpp");
+    auto export_header_fn =
+        fs::path(fmt::format("{}-export.h", project_name));
 
     auto header_path = fs::path(output_dir) / header_fn;
     auto private_header_path = fs::path(output_dir) / private_header_fn;
     auto source_path = fs::path(output_dir) / source_fn;
+    auto export_header_path = fs::path(output_dir) / export_header_fn;
 
-    write_error_header(header_path.c_str(), project_name);
+    write_export_header(export_header_path.c_str(), project_name);
+    write_error_header(header_path.c_str(), export_header_fn.c_str(),
+                       project_name);
     write_error_header_private(private_header_path.c_str(), project_name);
     write_error_source(source_path.c_str(), header_fn.c_str(),
                        private_header_fn.c_str(), project_name);
@@ -832,8 +1355,1045 @@ void cerrors(const char* output_dir, Root& root, size_t starting_point,
     const auto size = root.tus.size();
     for (size_t i = starting_point; i < size; ++i) {
         auto& tu = root.tus[i];
-        tu->private_includes.insert(
-            fmt::format("#include \"{}\"\n", private_header_fn.string()));
+        tu->source_includes.insert(
+            fmt::format("#include \"{}\"", private_header_fn.string()));
+        tu->header_includes.insert(
+            fmt::format("#include \"{}\"", export_header_fn.string()));
+    }
+}
+
+//------------------------------------------------------------------------------
+void write_string_table_header(const char* filename) {
+    auto out = fmt::output_file(filename);
+
+    out.print(R"(#pragma once
+#include <cstring>
+
+// Pack a container of strings into one buffer. See the string_table()
+// wrappers for a description of the parameters.
+template <typename T>
+void tlg_string_table(const T& strings, char* buffer,
+                      size_t buffer_len, size_t* offsets,
+                      size_t offsets_len, size_t* bytes, size_t* count) {{
+    size_t total = 0;
+    for (const auto& s : strings) {{
+        total += s.size();
+    }}
+
+    *bytes = total;
+    *count = strings.size();
+    if (buffer_len < total || offsets_len < strings.size() + 1) {{
+        return;
+    }}
+
+    size_t offset = 0;
+    for (const auto& s : strings) {{
+        *offsets++ = offset;
+        std::memcpy(buffer + offset, s.data(), s.size());
+        offset += s.size();
+    }}
+    *offsets = offset;
+}}
+)");
+}
+
+//------------------------------------------------------------------------------
+void cstringtable(const char* output_dir, Root& root, size_t starting_point,
+                  const char* project_name) {
+    expect(starting_point < root.tus.size(),
+           "starting point ({}) is out of range ({})", starting_point,
+           root.tus.size());
+
+    auto header_fn =
+        fs::path(fmt::format("{}-string-table-private.h", project_name));
+
+    // Only the translation units with string containers need the helper
+    bool any = false;
+    const auto size = root.tus.size();
+    for (size_t i = starting_point; i < size; ++i) {
+        auto& tu = root.tus[i];
+        for (const auto& node : tu->decls) {
+            if (node->kind == NodeKind::Record &&
+                static_cast<const NodeRecord*>(node.get())
+                    ->string_table_function) {
+                tu->source_includes.insert(
+                    fmt::format("#include \"{}\"", header_fn.string()));
+                any = true;
+                break;
+            }
+        }
+    }
+
+    if (any) {
+        auto header_path = fs::path(output_dir) / header_fn;
+        write_string_table_header(header_path.c_str());
+    }
+}
+
+
+//------------------------------------------------------------------------------
+void write_cast_header(const char* filename) {
+    auto out = fmt::output_file(filename);
+
+    out.print(R"(#pragma once
+
+namespace cppmm {{
+
+// The conversions between a c type and the cpp type it wraps. The c type is
+// either the storage for the cpp object or an opaque handle to it, so every
+// conversion is a reinterpret_cast.
+template <typename C, typename Cpp> struct cast {{
+    using c_type = C;
+    using cpp_type = Cpp;
+
+    static Cpp const* to_cpp(C const* rhs) {{
+        return reinterpret_cast<Cpp const*>(rhs);
+    }}
+    static Cpp* to_cpp(C* rhs) {{ return reinterpret_cast<Cpp*>(rhs); }}
+
+    static Cpp const& to_cpp_ref(C const* rhs) {{ return *to_cpp(rhs); }}
+    static Cpp& to_cpp_ref(C* rhs) {{ return *to_cpp(rhs); }}
+
+    static void to_c(C const** lhs, Cpp const& rhs) {{
+        *lhs = reinterpret_cast<C const*>(&rhs);
+    }}
+    static void to_c(C const** lhs, Cpp const* rhs) {{
+        *lhs = reinterpret_cast<C const*>(rhs);
+    }}
+    static void to_c(C** lhs, Cpp& rhs) {{ *lhs = reinterpret_cast<C*>(&rhs); }}
+    static void to_c(C** lhs, Cpp* rhs) {{ *lhs = reinterpret_cast<C*>(rhs); }}
+}};
+
+// Specialised in the private headers to derive from the cast for each
+// record's c type, which is how the functions below find it. Types that
+// aren't records have no cpp_type here, which takes them out of overload
+// resolution.
+template <typename C> struct cast_from_c {{}};
+
+}} // namespace cppmm
+
+template <typename C>
+typename cppmm::cast_from_c<C>::cpp_type const* to_cpp(C const* rhs) {{
+    return cppmm::cast_from_c<C>::to_cpp(rhs);
+}}
+
+template <typename C>
+typename cppmm::cast_from_c<C>::cpp_type* to_cpp(C* rhs) {{
+    return cppmm::cast_from_c<C>::to_cpp(rhs);
+}}
+
+template <typename C>
+typename cppmm::cast_from_c<C>::cpp_type const& to_cpp_ref(C const* rhs) {{
+    return cppmm::cast_from_c<C>::to_cpp_ref(rhs);
+}}
+
+template <typename C>
+typename cppmm::cast_from_c<C>::cpp_type& to_cpp_ref(C* rhs) {{
+    return cppmm::cast_from_c<C>::to_cpp_ref(rhs);
+}}
+
+// The cpp type isn't deduced, so that a derived object converts to the base
+// the c type wraps just as it would when passed to a function taking a base.
+template <typename C>
+void to_c(C const** lhs,
+          typename cppmm::cast_from_c<C>::cpp_type const& rhs) {{
+    cppmm::cast_from_c<C>::to_c(lhs, rhs);
+}}
+
+template <typename C>
+void to_c(C const** lhs,
+          typename cppmm::cast_from_c<C>::cpp_type const* rhs) {{
+    cppmm::cast_from_c<C>::to_c(lhs, rhs);
+}}
+
+template <typename C>
+void to_c(C** lhs, typename cppmm::cast_from_c<C>::cpp_type& rhs) {{
+    cppmm::cast_from_c<C>::to_c(lhs, rhs);
+}}
+
+template <typename C>
+void to_c(C** lhs, typename cppmm::cast_from_c<C>::cpp_type* rhs) {{
+    cppmm::cast_from_c<C>::to_c(lhs, rhs);
+}}
+)");
+}
+
+//------------------------------------------------------------------------------
+void ccast(const char* output_dir, Root& root, size_t starting_point,
+           const char* project_name) {
+    expect(starting_point < root.tus.size(),
+           "starting point ({}) is out of range ({})", starting_point,
+           root.tus.size());
+
+    auto header_fn = fs::path(fmt::format("{}-cast-private.h", project_name));
+
+    // Only the translation units with records need the casts
+    bool any = false;
+    const auto size = root.tus.size();
+    for (size_t i = starting_point; i < size; ++i) {
+        auto& tu = root.tus[i];
+        if (!tu->casts.empty()) {
+            tu->private_includes.insert(
+                fmt::format("#include \"{}\"", header_fn.string()));
+            any = true;
+        }
+    }
+
+    if (any) {
+        auto header_path = fs::path(output_dir) / header_fn;
+        write_cast_header(header_path.c_str());
+    }
+}
+
+//------------------------------------------------------------------------------
+void write_pool_header(const char* filename, const char* export_header,
+                       const char* project_name) {
+    auto out = fmt::output_file(filename);
+
+    out.print(R"(#pragma once
+#include "{2}"
+#ifdef __cplusplus
+extern "C" {{
+#endif
+
+/// A bump allocator that the _arena constructors of pooled records allocate
+/// from. An arena must only be used by one thread at a time.
+typedef struct {0}_arena_s {0}_arena_t;
+
+/// Create an arena that allocates chunk_size bytes at a time (64KiB if 0)
+{1} {0}_arena_t* {0}_arena_create(unsigned long chunk_size);
+
+/// Free everything allocated from the arena at once, keeping its first chunk
+/// for reuse. Objects allocated from it must have been destroyed already.
+{1} void {0}_arena_reset({0}_arena_t* arena);
+
+/// Free the arena and everything allocated from it
+{1} void {0}_arena_destroy({0}_arena_t* arena);
+
+#ifdef __cplusplus
+}}
+#endif
+)",
+              project_name, compute_export_macro(project_name), export_header);
+}
+
+//------------------------------------------------------------------------------
+void write_pool_header_private(const char* filename, const char* pool_header,
+                               const char* project_name) {
+    auto out = fmt::output_file(filename);
+
+    // Objects of pooled records carry a small header in front of them saying
+    // where their memory came from, so the one destructor wrapper can hand it
+    // back to the pool or leave it for the arena.
+    out.print(R"(#pragma once
+#include "{0}"
+#include <cstddef>
+#include <new>
+#include <utility>
+
+#ifndef TLG_POOL_CACHE_SIZE
+#define TLG_POOL_CACHE_SIZE 64
+#endif
+
+struct alignas(std::max_align_t) tlg_pool_header {{
+    // The arena the object was allocated from, or null for the pool
+    {1}* arena;
+}};
+
+void* tlg_arena_allocate({1}* arena, size_t bytes);
+
+// A per-thread cache of freed blocks for each pooled type, so that creating
+// and destroying objects doesn't contend on the global allocator. Blocks can
+// be freed on any thread, and each thread keeps at most TLG_POOL_CACHE_SIZE.
+template <typename T> class tlg_pool {{
+    static_assert(alignof(T) <= alignof(std::max_align_t),
+                  "over-aligned types cannot be pooled");
+
+    struct Block {{
+        Block* next;
+    }};
+
+    struct Cache {{
+        Block* head = nullptr;
+        size_t count = 0;
+
+        ~Cache() {{
+            while (head) {{
+                Block* block = head;
+                head = head->next;
+                ::operator delete(block);
+            }}
+        }}
+    }};
+
+    static Cache& cache() {{
+        static thread_local Cache c;
+        return c;
+    }}
+
+public:
+    static constexpr size_t size = sizeof(tlg_pool_header) + sizeof(T);
+
+    static void* allocate() {{
+        Cache& c = cache();
+        if (c.head) {{
+            Block* block = c.head;
+            c.head = block->next;
+            --c.count;
+            return block;
+        }}
+        return ::operator new(size);
+    }}
+
+    static void deallocate(void* p) {{
+        Cache& c = cache();
+        if (c.count < TLG_POOL_CACHE_SIZE) {{
+            Block* block = static_cast<Block*>(p);
+            block->next = c.head;
+            c.head = block;
+            ++c.count;
+        }} else {{
+            ::operator delete(p);
+        }}
+    }}
+}};
+
+// Hands the block back to the pool if construction throws
+template <typename T> struct tlg_pool_guard {{
+    void* block;
+
+    ~tlg_pool_guard() {{
+        if (block) {{
+            tlg_pool<T>::deallocate(block);
+        }}
+    }}
+}};
+
+template <typename T> T* tlg_pool_object(void* block, {1}* arena) {{
+    static_cast<tlg_pool_header*>(block)->arena = arena;
+    return reinterpret_cast<T*>(static_cast<char*>(block) +
+                                sizeof(tlg_pool_header));
+}}
+
+template <typename T, typename... Args> T* tlg_pool_new(Args&&... args) {{
+    tlg_pool_guard<T> guard{{tlg_pool<T>::allocate()}};
+    T* object = new (tlg_pool_object<T>(guard.block, nullptr))
+        T(std::forward<Args>(args)...);
+    guard.block = nullptr;
+    return object;
+}}
+
+template <typename T, typename... Args>
+T* tlg_arena_new({1}* arena, Args&&... args) {{
+    void* block = tlg_arena_allocate(arena, tlg_pool<T>::size);
+    return new (tlg_pool_object<T>(block, arena))
+        T(std::forward<Args>(args)...);
+}}
+
+template <typename T> void tlg_pool_delete(T* object) {{
+    if (!object) {{
+        return;
+    }}
+
+    object->~T();
+
+    void* block = reinterpret_cast<char*>(object) - sizeof(tlg_pool_header);
+    if (!static_cast<tlg_pool_header*>(block)->arena) {{
+        tlg_pool<T>::deallocate(block);
+    }}
+}}
+)",
+              pool_header, fmt::format("{}_arena_t", project_name));
+}
+
+//------------------------------------------------------------------------------
+void write_pool_source(const char* filename, const char* private_header,
+                       const char* project_name) {
+    auto out = fmt::output_file(filename);
+
+    out.print(R"(#include "{0}"
+
+// The arena's memory is a list of chunks, newest first, each starting with
+// this header. Allocations are bumped out of the newest chunk.
+struct tlg_arena_chunk {{
+    tlg_arena_chunk* next;
+    size_t size;
+}};
+
+struct {1}_arena_s {{
+    tlg_arena_chunk* chunks;
+    char* cursor;
+    char* end;
+    size_t chunk_size;
+}};
+
+static const size_t TLG_CHUNK_HEADER_SIZE =
+    (sizeof(tlg_arena_chunk) + alignof(std::max_align_t) - 1) &
+    ~(alignof(std::max_align_t) - 1);
+
+static void tlg_arena_add_chunk({1}_arena_t* arena, size_t bytes) {{
+    const size_t size = bytes > arena->chunk_size ? bytes : arena->chunk_size;
+    auto* chunk = static_cast<tlg_arena_chunk*>(
+        ::operator new(TLG_CHUNK_HEADER_SIZE + size));
+    chunk->next = arena->chunks;
+    chunk->size = size;
+    arena->chunks = chunk;
+    arena->cursor = reinterpret_cast<char*>(chunk) + TLG_CHUNK_HEADER_SIZE;
+    arena->end = arena->cursor + size;
+}}
+
+void* tlg_arena_allocate({1}_arena_t* arena, size_t bytes) {{
+    // Keep every allocation aligned for any type
+    bytes = (bytes + alignof(std::max_align_t) - 1) &
+            ~(alignof(std::max_align_t) - 1);
+    if (static_cast<size_t>(arena->end - arena->cursor) < bytes) {{
+        tlg_arena_add_chunk(arena, bytes);
+    }}
+    void* result = arena->cursor;
+    arena->cursor += bytes;
+    return result;
+}}
+
+{1}_arena_t* {1}_arena_create(unsigned long chunk_size) {{
+    auto* arena = new {1}_arena_t;
+    arena->chunks = nullptr;
+    arena->cursor = nullptr;
+    arena->end = nullptr;
+    arena->chunk_size = chunk_size ? chunk_size : 64 * 1024;
+    return arena;
+}}
+
+void {1}_arena_reset({1}_arena_t* arena) {{
+    if (!arena->chunks) {{
+        return;
+    }}
+
+    // Keep the oldest chunk, which is the one made with the arena's chunk size
+    tlg_arena_chunk* chunk = arena->chunks;
+    while (chunk->next) {{
+        tlg_arena_chunk* next = chunk->next;
+        ::operator delete(chunk);
+        chunk = next;
+    }}
+    arena->chunks = chunk;
+    arena->cursor = reinterpret_cast<char*>(chunk) + TLG_CHUNK_HEADER_SIZE;
+    arena->end = arena->cursor + chunk->size;
+}}
+
+void {1}_arena_destroy({1}_arena_t* arena) {{
+    tlg_arena_chunk* chunk = arena->chunks;
+    while (chunk) {{
+        tlg_arena_chunk* next = chunk->next;
+        ::operator delete(chunk);
+        chunk = next;
+    }}
+    delete arena;
+}}
+)",
+              private_header, project_name);
+}
+
+//------------------------------------------------------------------------------
+void write_task_header(const char* filename, const char* export_header,
+                       const char* project_name) {
+    auto out = fmt::output_file(filename);
+
+    out.print(R"(#pragma once
+#include "{2}"
+#ifdef __cplusplus
+extern "C" {{
+#endif
+
+/// A call started by one of the _async functions, running on the library's
+/// worker threads. Every task must be finished with {0}_task_result.
+typedef struct {0}_task_s {0}_task_t;
+
+/// Returns 1 if the task has finished and 0 if it's still running
+{1} int {0}_task_poll({0}_task_t* task);
+
+/// Block until the task has finished
+{1} void {0}_task_wait({0}_task_t* task);
+
+/// Wait for the task, free it and return the result of the call. On error the
+/// exception string is set on the calling thread, as for a direct call.
+{1} unsigned int {0}_task_result({0}_task_t* task);
+
+/// Call callback(user_data) once when the task finishes, from the worker
+/// thread, or straight away if it has already finished. Only one callback can
+/// be set per task.
+{1} void {0}_task_on_complete({0}_task_t* task, void (*callback)(void*),
+                              void* user_data);
+
+#ifdef __cplusplus
+}}
+#endif
+)",
+              project_name, compute_export_macro(project_name), export_header);
+}
+
+//------------------------------------------------------------------------------
+void write_task_header_private(const char* filename, const char* task_header,
+                               const char* project_name) {
+    auto out = fmt::output_file(filename);
+
+    out.print(R"(#pragma once
+#include "{0}"
+#include <functional>
+
+// Queue fn on the worker threads, returning the task to wait on for its result
+{1}* tlg_task_submit(std::function<unsigned int()> fn);
+
+// Run f(args...) on the worker threads. The arguments are copied into the
+// task, so whatever they point to must outlive it.
+template <typename F, typename... Args>
+{1}* tlg_task_async(F f, Args... args) {{
+    return tlg_task_submit([=]() {{ return f(args...); }});
+}}
+)",
+              task_header, fmt::format("{}_task_t", project_name));
+}
+
+//------------------------------------------------------------------------------
+void write_task_source(const char* filename, const char* private_header,
+                       const char* errors_private_header,
+                       const char* project_name) {
+    auto out = fmt::output_file(filename);
+
+    // The worker pool is a fixed number of threads started on the first
+    // submit, sharing a single queue. Callbacks are copied out before the task
+    // is marked as finished, since it may be freed as soon as it is. When the
+    // pool is destroyed the workers drain the queue before they exit, so no
+    // task is left unfinished for a waiter to hang on.
+    out.print(R"(#include "{0}"
+#include "{1}"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#ifndef TLG_TASK_THREADS
+#define TLG_TASK_THREADS 4
+#endif
+
+struct {2}_task_s {{
+    std::function<unsigned int()> fn;
+    std::mutex mutex;
+    std::condition_variable finished;
+    bool done = false;
+    unsigned int result = 0;
+    char exception_string[TLG_EXCEPTION_STRING_SIZE] = {{}};
+    void (*callback)(void*) = nullptr;
+    void* user_data = nullptr;
+}};
+
+namespace {{
+
+class tlg_task_pool {{
+    std::mutex mutex;
+    std::condition_variable queued;
+    std::deque<{2}_task_t*> queue;
+    std::vector<std::thread> threads;
+    bool stopping = false;
+
+    void run() {{
+        for (;;) {{
+            {2}_task_t* task;
+            {{
+                std::unique_lock<std::mutex> lock(mutex);
+                queued.wait(lock,
+                            [this] {{ return stopping || !queue.empty(); }});
+                if (queue.empty()) {{
+                    return;
+                }}
+                task = queue.front();
+                queue.pop_front();
+            }}
+
+            const unsigned int result = task->fn();
+
+            std::unique_lock<std::mutex> lock(task->mutex);
+            task->fn = nullptr;
+            task->result = result;
+            if (result != 0) {{
+                std::strncpy(task->exception_string, TLG_EXCEPTION_STRING,
+                             TLG_EXCEPTION_STRING_SIZE - 1);
+            }}
+            auto callback = task->callback;
+            auto user_data = task->user_data;
+            task->done = true;
+            task->finished.notify_all();
+            lock.unlock();
+
+            if (callback) {{
+                callback(user_data);
+            }}
+        }}
+    }}
+
+public:
+    ~tlg_task_pool() {{
+        {{
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }}
+        queued.notify_all();
+        for (auto& t : threads) {{
+            t.join();
+        }}
+    }}
+
+    void submit({2}_task_t* task) {{
+        {{
+            std::lock_guard<std::mutex> lock(mutex);
+            if (threads.empty()) {{
+                for (int i = 0; i < TLG_TASK_THREADS; ++i) {{
+                    threads.emplace_back([this] {{ run(); }});
+                }}
+            }}
+            queue.push_back(task);
+        }}
+        queued.notify_one();
+    }}
+}};
+
+tlg_task_pool& task_pool() {{
+    static tlg_task_pool pool;
+    return pool;
+}}
+
+}} // namespace
+
+{2}_task_t* tlg_task_submit(std::function<unsigned int()> fn) {{
+    auto* task = new {2}_task_t;
+    task->fn = std::move(fn);
+    task_pool().submit(task);
+    return task;
+}}
+
+int {2}_task_poll({2}_task_t* task) {{
+    std::lock_guard<std::mutex> lock(task->mutex);
+    return task->done;
+}}
+
+void {2}_task_wait({2}_task_t* task) {{
+    std::unique_lock<std::mutex> lock(task->mutex);
+    task->finished.wait(lock, [task] {{ return task->done; }});
+}}
+
+unsigned int {2}_task_result({2}_task_t* task) {{
+    {2}_task_wait(task);
+
+    const unsigned int result = task->result;
+    if (result != 0) {{
+        tlg_set_exception_string(task->exception_string);
+    }}
+    delete task;
+    return result;
+}}
+
+void {2}_task_on_complete({2}_task_t* task, void (*callback)(void*),
+                          void* user_data) {{
+    {{
+        std::lock_guard<std::mutex> lock(task->mutex);
+        if (!task->done) {{
+            task->callback = callback;
+            task->user_data = user_data;
+            return;
+        }}
+    }}
+    callback(user_data);
+}}
+)",
+              private_header, errors_private_header, project_name);
+}
+
+//------------------------------------------------------------------------------
+void ctask(const char* output_dir, Root& root, size_t starting_point,
+           const char* project_name) {
+    if (!has_async_functions(root, starting_point)) {
+        return;
+    }
+
+    auto header_fn = fs::path(fmt::format("{}-task.h", project_name));
+    auto private_header_fn =
+        fs::path(fmt::format("{}-task-private.h", project_name));
+    auto source_fn = fs::path(fmt::format("{}-task.cpp", project_name));
+    auto export_header_fn =
+        fs::path(fmt::format("{}-export.h", project_name));
+    auto errors_private_header_fn =
+        fs::path(fmt::format("{}-errors-private.h", project_name));
+
+    write_task_header((fs::path(output_dir) / header_fn).c_str(),
+                      export_header_fn.c_str(), project_name);
+    write_task_header_private(
+        (fs::path(output_dir) / private_header_fn).c_str(),
+        header_fn.c_str(), project_name);
+    write_task_source((fs::path(output_dir) / source_fn).c_str(),
+                      private_header_fn.c_str(),
+                      errors_private_header_fn.c_str(), project_name);
+
+    // Only the translation units with async functions need the tasks
+    const auto size = root.tus.size();
+    for (size_t i = starting_point; i < size; ++i) {
+        auto& tu = root.tus[i];
+        for (const auto& node : tu->decls) {
+            if (node->kind != NodeKind::Function) {
+                continue;
+            }
+
+            const auto& attrs = static_cast<const NodeFunction&>(*node).attrs;
+            if (std::find(attrs.begin(), attrs.end(), attr::ASYNC) !=
+                attrs.end()) {
+                tu->header_includes.insert(
+                    fmt::format("#include \"{}\"", header_fn.string()));
+                tu->source_includes.insert(
+                    fmt::format("#include \"{}\"", private_header_fn.string()));
+                break;
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+void write_stats_header(const char* filename, const char* export_header,
+                        const char* project_name) {
+    auto out = fmt::output_file(filename);
+
+    out.print(R"(#pragma once
+#include "{2}"
+#ifdef __cplusplus
+extern "C" {{
+#endif
+
+/// Write the number of calls to each wrapper called since the last reset, one
+/// per line, to filename, or to stderr if filename is null. When the library
+/// is built with TLG_STATS_LATENCY each line also has a histogram of the call
+/// latencies in power of two nanosecond buckets. Writes nothing if the
+/// library was built without TLG_STATS.
+{1} void {0}_stats_dump(const char* filename);
+
+/// Zero all the call counters
+{1} void {0}_stats_reset();
+
+#ifdef __cplusplus
+}}
+#endif
+)",
+              project_name, compute_export_macro(project_name), export_header);
+}
+
+//------------------------------------------------------------------------------
+void write_stats_header_private(const char* filename,
+                                const char* stats_header) {
+    auto out = fmt::output_file(filename);
+
+    // Each thread counts into its own block, so a probe is a couple of
+    // uncontended relaxed loads and stores. The atomics are only there so
+    // that dumping from another thread is well defined.
+    out.print(R"(#pragma once
+#include "{0}"
+
+#ifdef TLG_STATS
+#include <atomic>
+#include <cstdint>
+
+#ifdef TLG_STATS_LATENCY
+#include <chrono>
+#endif
+
+#define TLG_STATS_BUCKETS 32
+
+struct tlg_stats_counters {{
+    std::atomic<uint64_t> calls;
+    // Latencies in [2^i, 2^(i+1)) nanoseconds
+    std::atomic<uint64_t> buckets[TLG_STATS_BUCKETS];
+}};
+
+// This thread's counters, one per wrapper, allocated on first use
+extern thread_local tlg_stats_counters* TLG_STATS_COUNTERS
+    __attribute__((tls_model("initial-exec")));
+tlg_stats_counters* tlg_stats_thread();
+
+inline void tlg_stats_increment(std::atomic<uint64_t>& counter) {{
+    counter.store(counter.load(std::memory_order_relaxed) + 1,
+                  std::memory_order_relaxed);
+}}
+
+class tlg_stats_probe {{
+    tlg_stats_counters& counters;
+#ifdef TLG_STATS_LATENCY
+    std::chrono::steady_clock::time_point start;
+#endif
+
+public:
+    explicit tlg_stats_probe(int id)
+        : counters((TLG_STATS_COUNTERS ? TLG_STATS_COUNTERS
+                                       : tlg_stats_thread())[id]) {{
+        tlg_stats_increment(counters.calls);
+#ifdef TLG_STATS_LATENCY
+        start = std::chrono::steady_clock::now();
+#endif
+    }}
+
+#ifdef TLG_STATS_LATENCY
+    ~tlg_stats_probe() {{
+        auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                      std::chrono::steady_clock::now() - start)
+                      .count();
+        int bucket = 0;
+        while (ns > 1 && bucket < TLG_STATS_BUCKETS - 1) {{
+            ns >>= 1;
+            ++bucket;
+        }}
+        tlg_stats_increment(counters.buckets[bucket]);
+    }}
+#endif
+}};
+
+#define TLG_STATS_PROBE(id) tlg_stats_probe tlg_stats_probe_(id)
+#else
+#define TLG_STATS_PROBE(id)
+#endif
+)",
+              stats_header);
+}
+
+//------------------------------------------------------------------------------
+void write_stats_source(const char* filename, const char* private_header,
+                        const std::vector<std::string>& names,
+                        const char* project_name) {
+    auto out = fmt::output_file(filename);
+
+    out.print(R"(#include "{0}"
+
+#include <cstdio>
+
+#ifdef TLG_STATS
+#include <mutex>
+#include <vector>
+
+#define TLG_STATS_FUNCTIONS {1}
+
+static const char* const TLG_STATS_NAMES[TLG_STATS_FUNCTIONS] = {{
+)",
+              private_header, names.size());
+
+    for (const auto& name : names) {
+        out.print("    \"{}\",\n", name);
+    }
+
+    // Threads register their counters when they first call a wrapper, and
+    // fold them into the retired totals when they exit, so the registry lock
+    // is never taken on the call path.
+    out.print(R"(}};
+
+thread_local tlg_stats_counters* TLG_STATS_COUNTERS
+    __attribute__((tls_model("initial-exec"))) = nullptr;
+
+namespace {{
+
+struct tlg_stats_registry {{
+    std::mutex mutex;
+    std::vector<tlg_stats_counters*> threads;
+    tlg_stats_counters retired[TLG_STATS_FUNCTIONS] = {{}};
+}};
+
+tlg_stats_registry& stats_registry() {{
+    static tlg_stats_registry registry;
+    return registry;
+}}
+
+void add_counters(tlg_stats_counters* lhs, const tlg_stats_counters* rhs) {{
+    for (int i = 0; i < TLG_STATS_FUNCTIONS; ++i) {{
+        lhs[i].calls += rhs[i].calls.load(std::memory_order_relaxed);
+        for (int b = 0; b < TLG_STATS_BUCKETS; ++b) {{
+            lhs[i].buckets[b] +=
+                rhs[i].buckets[b].load(std::memory_order_relaxed);
+        }}
+    }}
+}}
+
+void zero_counters(tlg_stats_counters* counters) {{
+    for (int i = 0; i < TLG_STATS_FUNCTIONS; ++i) {{
+        counters[i].calls.store(0, std::memory_order_relaxed);
+        for (int b = 0; b < TLG_STATS_BUCKETS; ++b) {{
+            counters[i].buckets[b].store(0, std::memory_order_relaxed);
+        }}
+    }}
+}}
+
+class tlg_stats_thread_counters {{
+public:
+    tlg_stats_counters* counters =
+        new tlg_stats_counters[TLG_STATS_FUNCTIONS]();
+
+    tlg_stats_thread_counters() {{
+        auto& registry = stats_registry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        registry.threads.push_back(counters);
+    }}
+
+    ~tlg_stats_thread_counters() {{
+        auto& registry = stats_registry();
+        {{
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            add_counters(registry.retired, counters);
+            for (auto& t : registry.threads) {{
+                if (t == counters) {{
+                    t = registry.threads.back();
+                    registry.threads.pop_back();
+                    break;
+                }}
+            }}
+        }}
+        TLG_STATS_COUNTERS = nullptr;
+        delete[] counters;
+    }}
+}};
+
+}} // namespace
+
+tlg_stats_counters* tlg_stats_thread() {{
+    thread_local tlg_stats_thread_counters thread_counters;
+    TLG_STATS_COUNTERS = thread_counters.counters;
+    return TLG_STATS_COUNTERS;
+}}
+
+void {0}_stats_dump(const char* filename) {{
+    auto totals = new tlg_stats_counters[TLG_STATS_FUNCTIONS]();
+    {{
+        auto& registry = stats_registry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        add_counters(totals, registry.retired);
+        for (auto* t : registry.threads) {{
+            add_counters(totals, t);
+        }}
+    }}
+
+    FILE* file = filename ? std::fopen(filename, "w") : stderr;
+    if (file) {{
+        for (int i = 0; i < TLG_STATS_FUNCTIONS; ++i) {{
+            const auto calls = totals[i].calls.load();
+            if (calls == 0) {{
+                continue;
+            }}
+
+            std::fprintf(file, "%s %llu", TLG_STATS_NAMES[i],
+                         (unsigned long long)calls);
+#ifdef TLG_STATS_LATENCY
+            for (int b = 0; b < TLG_STATS_BUCKETS; ++b) {{
+                std::fprintf(file, " %llu",
+                             (unsigned long long)totals[i].buckets[b].load());
+            }}
+#endif
+            std::fprintf(file, "\n");
+        }}
+
+        if (filename) {{
+            std::fclose(file);
+        }}
+    }}
+
+    delete[] totals;
+}}
+
+void {0}_stats_reset() {{
+    auto& registry = stats_registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    zero_counters(registry.retired);
+    for (auto* t : registry.threads) {{
+        zero_counters(t);
+    }}
+}}
+#else
+void {0}_stats_dump(const char*) {{}}
+
+void {0}_stats_reset() {{}}
+#endif
+)",
+              project_name);
+}
+
+//------------------------------------------------------------------------------
+void cstats(const char* output_dir, Root& root, size_t starting_point,
+            const char* project_name) {
+    auto header_fn = fs::path(fmt::format("{}-stats.h", project_name));
+    auto private_header_fn =
+        fs::path(fmt::format("{}-stats-private.h", project_name));
+    auto source_fn = fs::path(fmt::format("{}-stats.cpp", project_name));
+    auto export_header_fn =
+        fs::path(fmt::format("{}-export.h", project_name));
+
+    // Number every exported wrapper that write_function_bdy writes to a
+    // source file. Inline and private functions aren't probed.
+    std::vector<std::string> names;
+    const auto size = root.tus.size();
+    for (size_t i = starting_point; i < size; ++i) {
+        auto& tu = root.tus[i];
+        for (auto& node : tu->decls) {
+            if (node->kind != NodeKind::Function) {
+                continue;
+            }
+
+            auto& function = static_cast<NodeFunction&>(*node);
+            if (function.private_ || function.inline_) {
+                continue;
+            }
+
+            function.stats_id = names.size();
+            names.push_back(function.nice_name);
+            tu->source_includes.insert(
+                fmt::format("#include \"{}\"", private_header_fn.string()));
+        }
+    }
+
+    write_stats_header((fs::path(output_dir) / header_fn).c_str(),
+                       export_header_fn.c_str(), project_name);
+    write_stats_header_private(
+        (fs::path(output_dir) / private_header_fn).c_str(),
+        header_fn.c_str());
+    write_stats_source((fs::path(output_dir) / source_fn).c_str(),
+                       private_header_fn.c_str(), names, project_name);
+}
+
+//------------------------------------------------------------------------------
+void cpool(const char* output_dir, Root& root, size_t starting_point,
+           const char* project_name) {
+    if (!has_pooled_records(root, starting_point)) {
+        return;
+    }
+
+    auto header_fn = fs::path(fmt::format("{}-pool.h", project_name));
+    auto private_header_fn =
+        fs::path(fmt::format("{}-pool-private.h", project_name));
+    auto source_fn = fs::path(fmt::format("{}-pool.cpp", project_name));
+    auto export_header_fn =
+        fs::path(fmt::format("{}-export.h", project_name));
+
+    write_pool_header((fs::path(output_dir) / header_fn).c_str(),
+                      export_header_fn.c_str(), project_name);
+    write_pool_header_private(
+        (fs::path(output_dir) / private_header_fn).c_str(),
+        header_fn.c_str(), project_name);
+    write_pool_source((fs::path(output_dir) / source_fn).c_str(),
+                      private_header_fn.c_str(), project_name);
+
+    // Only the translation units with pooled records need the allocators
+    const auto size = root.tus.size();
+    for (size_t i = starting_point; i < size; ++i) {
+        auto& tu = root.tus[i];
+        for (const auto& node : tu->decls) {
+            if (node->kind == NodeKind::Record &&
+                is_pooled(*static_cast<const NodeRecord*>(node.get()))) {
+                tu->header_includes.insert(
+                    fmt::format("#include \"{}\"", header_fn.string()));
+                tu->source_includes.insert(
+                    fmt::format("#include \"{}\"", private_header_fn.string()));
+                break;
+            }
+        }
     }
 }
 
@@ -11,6 +11,7 @@
 
 #include <iostream>
 #include <set>
+#include <vector>
 
 #include "filesystem.hpp"
 
@@ -51,11 +52,103 @@ const std::string compute_cmakefile_path(const std::string& filename) {
     return fs::path(filename).parent_path() / "CMakeLists.txt";
 }
 
+//------------------------------------------------------------------------------
+// Pull the header name, including its <> or "" delimiters, out of an include
+// directive.
+std::string include_header_name(const std::string& include) {
+    auto name = pystring::strip(include);
+    if (pystring::startswith(name, "#include")) {
+        name = pystring::strip(pystring::slice(name, 8));
+    }
+    return name;
+}
+
+//------------------------------------------------------------------------------
+// Collect the headers that every generated source file pulls in, so they can
+// be precompiled once for the whole library. CMake forces the precompiled
+// headers into every source, so a header only some of them include is left
+// out: it may define things that must only be compiled once. Our own generated
+// headers change with every run, so they are left out too.
+std::set<std::string>
+compute_precompile_headers(const Root& root, size_t starting_point,
+                           const char* base_project_name) {
+    // All the helper headers are named after the project, such as
+    // "<project>-errors.h" and "<project>-cast-private.h"
+    const auto helper_prefix = fmt::format("\"{}-", base_project_name);
+
+    std::set<std::string> generated;
+    const auto size = root.tus.size();
+    for (size_t i = starting_point; i < size; ++i) {
+        const auto& tu = root.tus[i];
+        generated.insert(include_header_name(tu->header_filename));
+        generated.insert(include_header_name(tu->private_header_filename));
+    }
+
+    auto is_generated = [&](const std::string& name) {
+        return pystring::startswith(name, helper_prefix) ||
+               generated.find(name) != generated.end();
+    };
+
+    std::set<std::string> result;
+    for (size_t i = starting_point; i < size; ++i) {
+        const auto& tu = root.tus[i];
+
+        std::set<std::string> headers;
+        for (const auto* includes :
+             {&tu->private_includes, &tu->source_includes}) {
+            for (const auto& include : *includes) {
+                auto name = include_header_name(include);
+                if (!name.empty() && !is_generated(name)) {
+                    headers.insert(name);
+                }
+            }
+        }
+
+        if (i == starting_point) {
+            result = std::move(headers);
+            continue;
+        }
+
+        for (auto it = result.begin(); it != result.end();) {
+            if (headers.find(*it) == headers.end()) {
+                it = result.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    return result;
+}
+
+//------------------------------------------------------------------------------
+void write_precompile_headers(fmt::ostream& out, const Root& root,
+                              size_t starting_point,
+                              const char* base_project_name) {
+    auto headers =
+        compute_precompile_headers(root, starting_point, base_project_name);
+    if (headers.empty()) {
+        return;
+    }
+
+    out.print("target_precompile_headers(${{LIBNAME}} PRIVATE\n");
+    for (const auto& h : headers) {
+        indent(out, 1);
+        if (h[0] == '<') {
+            out.print("\"{}\"\n", h);
+        } else {
+            out.print("[[{}]]\n", h);
+        }
+    }
+    out.print(")\n");
+}
+
 //------------------------------------------------------------------------------
 void cmake(const char* project_name, const Root& root, size_t starting_point,
            const Libs& libs, const LibDirs& lib_dirs, int version_major,
            int version_minor, int version_patch,
-           const char* base_project_name) {
+           const char* base_project_name, bool static_lib, bool unity_build,
+           int unity_batch_size, bool precompile_headers, bool exceptions) {
     expect(starting_point < root.tus.size(),
            "starting point ({}) is out of range ({})", starting_point,
            root.tus.size());
@@ -65,8 +158,12 @@ void cmake(const char* project_name, const Root& root, size_t starting_point,
 
     auto out = fmt::output_file(cmakefile_path);
 
-    // Minimum version
-    out.print("cmake_minimum_required(VERSION 3.5)\n");
+    // Minimum version. Unity builds and precompiled headers need 3.16
+    if (unity_build || precompile_headers) {
+        out.print("cmake_minimum_required(VERSION 3.16)\n");
+    } else {
+        out.print("cmake_minimum_required(VERSION 3.5)\n");
+    }
     out.print("project({} VERSION {}.{}.{})\n", project_name, version_major,
               version_minor, version_patch);
     out.print("set(CMAKE_CXX_STANDARD 14 CACHE STRING \"\")\n");
@@ -76,7 +173,8 @@ void cmake(const char* project_name, const Root& root, size_t starting_point,
 
     out.print("set(LIBNAME {}-{}_{})\n", project_name, version_major,
               version_minor);
-    out.print("add_library(${{LIBNAME}} SHARED\n");
+    out.print("add_library(${{LIBNAME}} {}\n",
+              static_lib ? "STATIC" : "SHARED");
     const auto size = root.tus.size();
     for (size_t i = starting_point; i < size; ++i) {
         const auto& tu = root.tus[i];
@@ -91,9 +189,69 @@ void cmake(const char* project_name, const Root& root, size_t starting_point,
             include_paths.insert(i);
         }
     }
-    out.print("{}\n", fmt::format("{}-errors.cpp", base_project_name));
+    // The runtime support sources don't include the bound library at all
+    std::vector<std::string> support_sources;
+    support_sources.push_back(
+        fmt::format("{}-errors.cpp", base_project_name));
+    if (has_pooled_records(root, starting_point)) {
+        support_sources.push_back(
+            fmt::format("{}-pool.cpp", base_project_name));
+    }
+    const bool async = has_async_functions(root, starting_point);
+    if (async) {
+        support_sources.push_back(
+            fmt::format("{}-task.cpp", base_project_name));
+    }
+    const bool instrumented = has_instrumented_functions(root, starting_point);
+    if (instrumented) {
+        support_sources.push_back(
+            fmt::format("{}-stats.cpp", base_project_name));
+    }
+    for (const auto& source : support_sources) {
+        out.print("{}\n", source);
+    }
     out.print(")\n");
 
+    // Only the wrappers marked with the project's export macro make up the
+    // library's interface, everything else (including the bound library's
+    // inline code) stays out of the dynamic symbol table.
+    out.print("set_target_properties(${{LIBNAME}} PROPERTIES "
+              "CXX_VISIBILITY_PRESET hidden VISIBILITY_INLINES_HIDDEN ON)\n");
+
+    // Nothing in the wrappers catches exceptions, so don't pay for the unwind
+    // tables either. Bound headers that throw need exceptions to compile
+    // though, so leave a way to turn it off.
+    if (!exceptions) {
+        out.print("option(CPPMM_NO_EXCEPTIONS \"Build without exception "
+                  "support\" ON)\n"
+                  "if(CPPMM_NO_EXCEPTIONS)\n"
+                  "    target_compile_options(${{LIBNAME}} PRIVATE "
+                  "-fno-exceptions)\n"
+                  "endif()\n");
+    }
+
+    // The static library ends up linked into the rust crate's artifacts, which
+    // may themselves be shared objects or position independent executables.
+    if (static_lib) {
+        out.print("set_target_properties(${{LIBNAME}} PROPERTIES "
+                  "POSITION_INDEPENDENT_CODE ON)\n");
+    }
+
+    // The generated sources share all their heavy includes, so batching them
+    // together and precompiling those includes saves most of the build time.
+    if (unity_build) {
+        out.print("set_target_properties(${{LIBNAME}} PROPERTIES "
+                  "UNITY_BUILD ON UNITY_BUILD_BATCH_SIZE {})\n",
+                  unity_batch_size);
+    }
+
+    if (precompile_headers) {
+        write_precompile_headers(out, root, starting_point, base_project_name);
+        out.print("set_source_files_properties({} PROPERTIES "
+                  "SKIP_PRECOMPILE_HEADERS ON)\n",
+                  pystring::join(" ", support_sources));
+    }
+
     // Add the include path of the output headers
     include_paths.insert(compute_out_include_path("./"));
 
@@ -115,6 +273,27 @@ void cmake(const char* project_name, const Root& root, size_t starting_point,
         out.print("target_link_libraries (${{LIBNAME}} ${{{}}})\n", lib_var);
     }
 
+    // The wrappers' probes compile to nothing unless these are on
+    if (instrumented) {
+        out.print("option(TLG_STATS \"Count the calls to each wrapper\" ON)\n");
+        out.print("option(TLG_STATS_LATENCY \"Time the calls to each wrapper\" "
+                  "OFF)\n");
+        out.print("if (TLG_STATS)\n");
+        out.print("    target_compile_definitions(${{LIBNAME}} PRIVATE "
+                  "TLG_STATS)\n");
+        out.print("endif()\n");
+        out.print("if (TLG_STATS_LATENCY)\n");
+        out.print("    target_compile_definitions(${{LIBNAME}} PRIVATE "
+                  "TLG_STATS_LATENCY)\n");
+        out.print("endif()\n");
+    }
+
+    // The async wrappers run on the task pool's threads
+    if (async) {
+        out.print("find_package(Threads REQUIRED)\n");
+        out.print("target_link_libraries(${{LIBNAME}} Threads::Threads)\n");
+    }
+
     // add install command for rust cmake
     out.print(
         "install(TARGETS ${{LIBNAME}} DESTINATION ${{CMAKE_INSTALL_PREFIX}})");
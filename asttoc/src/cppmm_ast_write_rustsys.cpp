@@ -1,11 +1,12 @@
-#include "case.hpp"
 #include "cppmm_ast.hpp"
+#include "cppmm_naming.hpp"
 #include "filesystem.hpp"
 #include "pystring.h"
 
 #include <fmt/os.h>
 
 #include <iostream>
+#include <unordered_map>
 
 namespace fs = ghc::filesystem;
 
@@ -30,6 +31,9 @@ namespace cppmm {
 class Root;
 namespace rust_sys {
 
+using naming::to_pascal_case;
+using naming::to_snake_case;
+
 std::string convert_builtin_type(const NodeBuiltinType* t) {
     if (t->type_name == "int") {
         return "c_int";
@@ -116,6 +120,9 @@ std::string convert_function_pointer_type(const NodeFunctionProtoType* t) {
     for (const auto& p : t->params) {
         params.push_back(convert_type(p.get()));
     }
+    if (return_type == "c_void") {
+        return fmt::format("extern fn({})", pystring::join(", ", params));
+    }
     return fmt::format("extern fn({}) -> {}", pystring::join(", ", params),
                        return_type);
 }
@@ -201,6 +208,14 @@ void write_record(fmt::ostream& out, const NodeRecord* node_record) {
         out.print("    _unused: [u8; 0],\n");
         out.print("}}");
 
+        if (!node_record->opaque_type) {
+            const auto prefix = pystring::slice(node_record->name, 0, -2);
+            out.print("\n\npub const {}_sizeof: usize = {};\n", prefix,
+                      node_record->size / 8);
+            out.print("pub const {}_alignof: usize = {};\n", prefix,
+                      node_record->align / 8);
+        }
+
     } else if (bt == BindType::OpaqueBytes) {
         out.print("#[repr(C, align({}))]\n", node_record->align / 8);
         out.print("#[derive(Clone)]\n");
@@ -226,15 +241,339 @@ impl Default for {} {{
     }
 }
 
+// Find the element type of a contiguous container from its data() wrapper,
+// whose return_ parameter is a pointer to a pointer to the element
+std::string slice_element_type(const NodeFunction* data_function) {
+    expect(data_function->params.size() == 2,
+           "data() wrapper {} should have this_ and return_ parameters",
+           data_function->name);
+    const auto* return_ = static_cast<const NodePointerType*>(
+        data_function->params[1].type.get());
+    const auto* data = static_cast<const NodePointerType*>(
+        return_->pointee_type.get());
+    return convert_type(data->pointee_type.get());
+}
+
+void write_record_slice(fmt::ostream& out, const NodeRecord* node_record) {
+    if (!node_record->data_function || !node_record->size_function) {
+        return;
+    }
+
+    const auto* data =
+        static_cast<const NodeFunction*>(node_record->data_function.get());
+    const auto* size =
+        static_cast<const NodeFunction*>(node_record->size_function.get());
+    const auto element = slice_element_type(data);
+
+    out.print(R"(
+impl {0} {{
+    /// Borrow the contents as a slice, without copying.
+    pub unsafe fn as_slice(&self) -> &[{1}] {{
+        let mut data = std::ptr::null();
+        let mut size = 0;
+        {2}(self, &mut data);
+        {3}(self, &mut size);
+        if size == 0 {{
+            &[]
+        }} else {{
+            std::slice::from_raw_parts(data, size)
+        }}
+    }}
+)",
+              node_record->name, element, data->name, size->name);
+
+    if (node_record->data_mut_function) {
+        const auto* data_mut = static_cast<const NodeFunction*>(
+            node_record->data_mut_function.get());
+        out.print(R"(
+    /// Mutably borrow the contents as a slice, without copying.
+    pub unsafe fn as_mut_slice(&mut self) -> &mut [{0}] {{
+        let mut data = std::ptr::null_mut();
+        let mut size = 0;
+        {1}(self, &mut data);
+        {2}(self, &mut size);
+        if size == 0 {{
+            &mut []
+        }} else {{
+            std::slice::from_raw_parts_mut(data, size)
+        }}
+    }}
+)",
+                  element, data_mut->name, size->name);
+    }
+
+    out.print("}}\n");
+}
+
+void write_record_string_table(fmt::ostream& out,
+                               const NodeRecord* node_record) {
+    if (!node_record->string_table_function) {
+        return;
+    }
+
+    const auto* string_table = static_cast<const NodeFunction*>(
+        node_record->string_table_function.get());
+
+    out.print(R"(
+impl {0} {{
+    /// Copy all the strings out in a single packed table.
+    pub unsafe fn string_table(&self) -> StringTable {{
+        let mut bytes = 0;
+        let mut count = 0;
+        {1}(self, std::ptr::null_mut(), 0, std::ptr::null_mut(), 0, &mut bytes, &mut count);
+        let mut data = vec![0u8; bytes];
+        let mut offsets = vec![0; count + 1];
+        {1}(self, data.as_mut_ptr() as *mut c_char, bytes, offsets.as_mut_ptr(), count + 1, &mut bytes, &mut count);
+        StringTable {{ data, offsets }}
+    }}
+}}
+)",
+              node_record->name, string_table->name);
+}
+
+bool has_string_tables(const Root& root, size_t starting_point) {
+    const auto size = root.tus.size();
+    for (size_t i = starting_point; i < size; ++i) {
+        for (const auto& node : root.tus[i]->decls) {
+            if (node->kind == NodeKind::Record &&
+                static_cast<const NodeRecord*>(node.get())
+                    ->string_table_function) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void write_string_table(fmt::ostream& out_lib) {
+    out_lib.print(R"(
+/// Strings packed into a single buffer by a container's string_table()
+pub struct StringTable {{
+    data: Vec<u8>,
+    offsets: Vec<usize>,
+}}
+
+impl StringTable {{
+    pub fn len(&self) -> usize {{
+        self.offsets.len() - 1
+    }}
+
+    pub fn is_empty(&self) -> bool {{
+        self.len() == 0
+    }}
+
+    /// The bytes of the string at index i
+    pub fn get_bytes(&self, i: usize) -> &[u8] {{
+        &self.data[self.offsets[i]..self.offsets[i + 1]]
+    }}
+
+    /// The string at index i, or None if it is not valid UTF-8
+    pub fn get(&self, i: usize) -> Option<&str> {{
+        std::str::from_utf8(self.get_bytes(i)).ok()
+    }}
+
+    pub fn iter(&self) -> impl Iterator<Item = Option<&str>> {{
+        (0..self.len()).map(move |i| self.get(i))
+    }}
+}}
+)");
+}
+
+void write_arena(fmt::ostream& out_lib, const char* project_name) {
+    out_lib.print(R"(
+/// A bump allocator that the _arena constructors of pooled records allocate
+/// from. An arena must only be used by one thread at a time.
+#[repr(C)]
+pub struct {0}_arena_t {{
+    _unused: [u8; 0],
+}}
+
+extern {{
+    pub fn {0}_arena_create(
+        chunk_size: std::os::raw::c_ulong,
+    ) -> *mut {0}_arena_t;
+    pub fn {0}_arena_reset(arena: *mut {0}_arena_t);
+    pub fn {0}_arena_destroy(arena: *mut {0}_arena_t);
+}}
+
+)",
+                  project_name);
+}
+
+void write_stats(fmt::ostream& out_lib, const char* project_name) {
+    out_lib.print(R"(
+extern {{
+    /// Write the number of calls to each wrapper to filename, or to stderr if
+    /// filename is null. Writes nothing unless the C library was built with
+    /// TLG_STATS.
+    pub fn {0}_stats_dump(filename: *const std::os::raw::c_char);
+    /// Zero all the call counters
+    pub fn {0}_stats_reset();
+}}
+
+)",
+                  project_name);
+}
+
+void write_task(fmt::ostream& out_lib, const char* project_name) {
+    // The future registers a completion callback on its first poll that wakes
+    // the last waker it was given. The callback owns a reference to the waker
+    // slot so that it stays valid however long the worker takes to call it.
+    out_lib.print(R"(
+/// A call started by one of the _async functions
+#[repr(C)]
+pub struct {0}_task_t {{
+    _unused: [u8; 0],
+}}
+
+extern {{
+    pub fn {0}_task_poll(task: *mut {0}_task_t) -> std::os::raw::c_int;
+    pub fn {0}_task_wait(task: *mut {0}_task_t);
+    pub fn {0}_task_result(task: *mut {0}_task_t) -> Exception;
+    pub fn {0}_task_on_complete(
+        task: *mut {0}_task_t,
+        callback: extern fn(*mut std::os::raw::c_void),
+        user_data: *mut std::os::raw::c_void,
+    );
+}}
+
+/// Awaits a task started by one of the _async functions. Dropping the future
+/// blocks until the task has finished.
+pub struct TaskFuture {{
+    task: *mut {0}_task_t,
+    waker: std::sync::Arc<std::sync::Mutex<Option<std::task::Waker>>>,
+    registered: bool,
+}}
+
+unsafe impl Send for TaskFuture {{}}
+
+impl TaskFuture {{
+    /// Take ownership of a task returned by an _async function
+    pub unsafe fn new(task: *mut {0}_task_t) -> TaskFuture {{
+        TaskFuture {{
+            task,
+            waker: std::sync::Arc::new(std::sync::Mutex::new(None)),
+            registered: false,
+        }}
+    }}
+
+    /// Block until the task has finished and return its result
+    pub fn wait(mut self) -> Exception {{
+        let task = std::mem::replace(&mut self.task, std::ptr::null_mut());
+        unsafe {{ {0}_task_result(task) }}
+    }}
+}}
+
+extern fn task_future_wake(user_data: *mut std::os::raw::c_void) {{
+    let waker = unsafe {{
+        std::sync::Arc::from_raw(
+            user_data as *const std::sync::Mutex<Option<std::task::Waker>>,
+        )
+    }};
+    let w = waker.lock().unwrap().take();
+    if let Some(w) = w {{
+        w.wake();
+    }}
+}}
+
+impl std::future::Future for TaskFuture {{
+    type Output = Exception;
+
+    fn poll(
+        mut self: std::pin::Pin<&mut Self>,
+        cx: &mut std::task::Context<'_>,
+    ) -> std::task::Poll<Exception> {{
+        // The task is freed once its result has been taken
+        if self.task.is_null() {{
+            panic!("TaskFuture polled after it completed");
+        }}
+
+        *self.waker.lock().unwrap() = Some(cx.waker().clone());
+        if !self.registered {{
+            self.registered = true;
+            let user_data = std::sync::Arc::into_raw(self.waker.clone());
+            unsafe {{
+                {0}_task_on_complete(
+                    self.task,
+                    task_future_wake,
+                    user_data as *mut std::os::raw::c_void,
+                );
+            }}
+        }}
+
+        if unsafe {{ {0}_task_poll(self.task) }} == 0 {{
+            return std::task::Poll::Pending;
+        }}
+        let task = std::mem::replace(&mut self.task, std::ptr::null_mut());
+        std::task::Poll::Ready(unsafe {{ {0}_task_result(task) }})
+    }}
+}}
+
+impl Drop for TaskFuture {{
+    fn drop(&mut self) {{
+        if !self.task.is_null() {{
+            unsafe {{ {0}_task_result(self.task) }};
+        }}
+    }}
+}}
+
+)",
+                  project_name);
+}
+
+// Write <callback>_closure(), which turns a closure into a function pointer
+// and user data pair using a trampoline, without boxing the closure
+void write_closure(fmt::ostream& out, const NodeFunctionPointerTypedef* fpt) {
+    const int user_data = find_user_data_param(*fpt);
+    if (user_data == -1) {
+        return;
+    }
+
+    std::vector<std::string> param_types;
+    std::vector<std::string> params;
+    std::vector<std::string> closure_types;
+    std::vector<std::string> args;
+    for (size_t i = 0; i < fpt->params.size(); ++i) {
+        const auto t = convert_type(fpt->params[i].type.get());
+        param_types.push_back(t);
+        params.push_back(fmt::format("a{}: {}", i, t));
+        if (int(i) != user_data) {
+            closure_types.push_back(t);
+            args.push_back(fmt::format("a{}", i));
+        }
+    }
+
+    auto ret = convert_type(fpt->return_type.get());
+    ret = ret == "c_void" ? "" : " -> " + ret;
+
+    const auto bound = fmt::format("FnMut({}){}",
+                                   pystring::join(", ", closure_types), ret);
+
+    out.print(R"(/// Turn a closure into a {0} and the user data to pass with it, without
+/// boxing. The closure must outlive every call made through them.
+pub fn {1}_closure<F: {2}>(f: &mut F) -> (extern fn({3}){4}, *mut c_void) {{
+    extern fn trampoline<F: {2}>({5}){4} {{
+        unsafe {{ (*(a{6} as *mut F))({7}) }}
+    }}
+    (trampoline::<F>, f as *mut F as *mut c_void)
+}}
+
+)",
+              fpt->nice_name, pystring::slice(fpt->nice_name, 0, -2), bound,
+              pystring::join(", ", param_types), ret,
+              pystring::join(", ", params), user_data,
+              pystring::join(", ", args));
+}
+
 bool has_rustify_enum_attr(const NodeEnum* node_enum) {
     return std::find(node_enum->attrs.begin(), node_enum->attrs.end(),
-                     "cppmm|rustify_enum") != node_enum->attrs.end();
+                     attr::RUSTIFY_ENUM) != node_enum->attrs.end();
 }
 
 std::string get_enum_prefix(const NodeEnum* node_enum) {
     for (const auto& a : node_enum->attrs) {
-        if (pystring::find(a, "cppmm|enum_prefix|") == 0) {
-            return a.substr(18);
+        if (pystring::find(a.str(), "cppmm|enum_prefix|") == 0) {
+            return a.str().substr(18);
         }
     }
     return "";
@@ -242,8 +581,8 @@ std::string get_enum_prefix(const NodeEnum* node_enum) {
 
 std::string get_enum_suffix(const NodeEnum* node_enum) {
     for (const auto& a : node_enum->attrs) {
-        if (pystring::find(a, "cppmm|enum_suffix|") == 0) {
-            return a.substr(18);
+        if (pystring::find(a.str(), "cppmm|enum_suffix|") == 0) {
+            return a.str().substr(18);
         }
     }
     return "";
@@ -364,6 +703,7 @@ void write_translation_unit(const char* out_dir, fmt::ostream& out_lib,
     std::vector<NodeFunction*> node_functions;
     std::vector<NodeRecord*> node_records;
     std::vector<NodeEnum*> node_enums;
+    std::vector<NodeFunctionPointerTypedef*> node_fpts;
 
     for (const auto& node : tu.decls) {
         if (node->kind == NodeKind::Function) {
@@ -372,6 +712,9 @@ void write_translation_unit(const char* out_dir, fmt::ostream& out_lib,
             node_records.push_back(static_cast<NodeRecord*>(node.get()));
         } else if (node->kind == NodeKind::Enum) {
             node_enums.push_back(static_cast<NodeEnum*>(node.get()));
+        } else if (node->kind == NodeKind::FunctionPointerTypedef) {
+            node_fpts.push_back(
+                static_cast<NodeFunctionPointerTypedef*>(node.get()));
         }
     }
 
@@ -387,10 +730,21 @@ void write_translation_unit(const char* out_dir, fmt::ostream& out_lib,
 
     for (const auto* n : node_records) {
         write_record(out, n);
+        write_record_slice(out, n);
+        write_record_string_table(out, n);
         out.print("\n");
 
         out_lib.print("pub use {}::{} as {};\n", mod_name, n->name,
                       n->nice_name);
+
+        if (bind_type(*n) == BindType::OpaquePtr && !n->opaque_type) {
+            const auto prefix = pystring::slice(n->name, 0, -2);
+            const auto nice_prefix = pystring::slice(n->nice_name, 0, -2);
+            for (const auto* constant : {"sizeof", "alignof"}) {
+                out_lib.print("pub use {}::{}_{} as {}_{};\n", mod_name,
+                              prefix, constant, nice_prefix, constant);
+            }
+        }
     }
 
     out_lib.print("\n");
@@ -412,6 +766,14 @@ void write_translation_unit(const char* out_dir, fmt::ostream& out_lib,
 
     out.print("\n");
 
+    for (const auto* n : node_fpts) {
+        if (find_user_data_param(*n) != -1) {
+            write_closure(out, n);
+            out_lib.print("pub use {}::{}_closure;\n", mod_name,
+                          pystring::slice(n->nice_name, 0, -2));
+        }
+    }
+
     out.print("extern \"C\" {{\n\n");
 
     for (const auto* n : node_functions) {
@@ -426,11 +788,213 @@ void write_translation_unit(const char* out_dir, fmt::ostream& out_lib,
     out.print("\n}} // extern \"C\"\n");
 }
 
+// Whether a function's return_ parameter gives back a builtin or a value type,
+// so that the function can be called over and over without leaking anything
+bool returns_plain_value(
+    const Param& param,
+    const std::unordered_map<NodeId, const NodeRecord*>& records) {
+    if (param.name != "return_" || param.type->kind != NodeKind::PointerType) {
+        return false;
+    }
+
+    const auto* pointee =
+        static_cast<const NodePointerType*>(param.type.get())
+            ->pointee_type.get();
+    if (pointee->kind == NodeKind::BuiltinType) {
+        return true;
+    } else if (pointee->kind == NodeKind::RecordType) {
+        const auto it =
+            records.find(static_cast<const NodeRecordType*>(pointee)->record);
+        return it != records.end() &&
+               bind_type(*it->second) == BindType::ValueType;
+    }
+
+    return false;
+}
+
+// The id of the record whose const method this is, if it takes no arguments
+// other than this_ and return_, or -1
+NodeId const_getter_record(
+    const NodeFunction& fn,
+    const std::unordered_map<NodeId, const NodeRecord*>& records) {
+    if (fn.params.size() != 2 || fn.params[0].name != "this_" ||
+        fn.params[0].type->kind != NodeKind::PointerType ||
+        !returns_plain_value(fn.params[1], records)) {
+        return -1;
+    }
+
+    const auto* this_type =
+        static_cast<const NodePointerType*>(fn.params[0].type.get())
+            ->pointee_type.get();
+    if (!this_type->const_ || this_type->kind != NodeKind::RecordType) {
+        return -1;
+    }
+
+    return static_cast<const NodeRecordType*>(this_type)->record;
+}
+
+// Write benches/bindings.rs with a Criterion benchmark of every function that
+// can be called without any setup: functions taking no arguments, default
+// constructors of value types, and const getters on default-constructed value
+// types. Returns false if there was nothing to benchmark.
+bool write_benches(const char* out_dir, const char* project_name,
+                   const Root& root, size_t starting_point) {
+    std::unordered_map<NodeId, const NodeRecord*> records;
+    std::vector<const NodeRecord*> default_constructible;
+    std::vector<const NodeFunction*> functions;
+    for (size_t i = starting_point; i < root.tus.size(); ++i) {
+        for (const auto& node : root.tus[i]->decls) {
+            if (node->kind == NodeKind::Record) {
+                const auto* record = static_cast<const NodeRecord*>(node.get());
+                records[record->id] = record;
+                if (bind_type(*record) == BindType::ValueType &&
+                    record->default_constructor) {
+                    default_constructible.push_back(record);
+                }
+            } else if (node->kind == NodeKind::Function &&
+                       !static_cast<const NodeFunction*>(node.get())
+                            ->private_) {
+                functions.push_back(
+                    static_cast<const NodeFunction*>(node.get()));
+            }
+        }
+    }
+
+    std::string zero_arg;
+    std::string constructors;
+    std::string getters;
+    // Only import what the benchmarks use, so the file builds warning-free
+    bool maybe_uninit = false;
+
+    for (const auto* fn : functions) {
+        if (fn->params.empty()) {
+            zero_arg += fmt::format(R"(
+    group.bench_function("{0}", |b| b.iter(|| unsafe {{ {0}() }}));
+)",
+                                    fn->nice_name);
+            continue;
+        }
+
+        if (fn->params.size() == 1 &&
+            returns_plain_value(fn->params[0], records)) {
+            maybe_uninit = true;
+            zero_arg += fmt::format(R"(
+    group.bench_function("{0}", |b| {{
+        b.iter(|| unsafe {{
+            let mut r = MaybeUninit::uninit();
+            {0}(r.as_mut_ptr());
+            r
+        }})
+    }});
+)",
+                                    fn->nice_name);
+            continue;
+        }
+
+        const auto it = records.find(const_getter_record(*fn, records));
+        if (it == records.end() ||
+            bind_type(*it->second) != BindType::ValueType ||
+            !it->second->default_constructor) {
+            continue;
+        }
+
+        const auto& ctor = static_cast<const NodeFunction&>(
+            *it->second->default_constructor);
+
+        maybe_uninit = true;
+        getters += fmt::format(R"(
+    let v = unsafe {{
+        let mut v = MaybeUninit::uninit();
+        {0}(v.as_mut_ptr()).into_result().unwrap();
+        v.assume_init()
+    }};
+    group.bench_function("{1}", |b| {{
+        b.iter(|| unsafe {{
+            let mut r = MaybeUninit::uninit();
+            {1}(black_box(&v), r.as_mut_ptr());
+            r
+        }})
+    }});
+)",
+                               ctor.nice_name, fn->nice_name);
+    }
+
+    for (const auto* record : default_constructible) {
+        const auto& ctor =
+            static_cast<const NodeFunction&>(*record->default_constructor);
+        maybe_uninit = true;
+        constructors += fmt::format(R"(
+    group.bench_function("{0}", |b| {{
+        b.iter(|| unsafe {{
+            let mut v = MaybeUninit::uninit();
+            {0}(v.as_mut_ptr());
+            v
+        }})
+    }});
+)",
+                                    ctor.nice_name);
+    }
+
+    std::vector<std::string> groups;
+    std::string body;
+    for (const auto& group : {std::make_pair("function", &zero_arg),
+                              std::make_pair("constructor", &constructors),
+                              std::make_pair("getter", &getters)}) {
+        if (group.second->empty()) {
+            continue;
+        }
+
+        const auto name = fmt::format("{}s", group.first);
+        body += fmt::format(R"(
+fn {}(c: &mut Criterion) {{
+    let mut group = c.benchmark_group("{}");{}    group.finish();
+}}
+)",
+                            name, group.first, *group.second);
+        groups.push_back(name);
+    }
+
+    if (groups.empty()) {
+        SPDLOG_WARN("No functions can be benchmarked without setup, so no "
+                    "benches will be written");
+        return false;
+    }
+
+    const auto benches_dir = fs::path(out_dir) / "benches";
+    if (!fs::is_directory(benches_dir)) {
+        fs::create_directories(benches_dir);
+    }
+
+    // Only the getters need their argument hidden from the optimizer
+    const auto criterion_imports =
+        getters.empty()
+            ? "criterion_group, criterion_main, Criterion"
+            : "black_box, criterion_group, criterion_main, Criterion";
+
+    auto out = fmt::output_file((benches_dir / "bindings.rs").string());
+    out.print(R"(// Baseline cost of calling every binding that needs no setup.
+// Generated by asttoc --benches, run with cargo bench.
+#![allow(non_snake_case)]
+use criterion::{{{0}}};
+{1}use {2}_sys::*;
+{3}
+criterion_group!(benches, {4});
+criterion_main!(benches);
+)",
+              criterion_imports,
+              maybe_uninit ? "use std::mem::MaybeUninit;\n" : "",
+              pystring::replace(project_name, "-", "_"), body,
+              pystring::join(", ", groups));
+
+    return true;
+}
+
 void write(const char* out_dir, const char* project_name, const char* c_dir,
            const Root& root, size_t starting_point,
            const std::vector<std::string>& libs,
            const std::vector<std::string>& lib_dirs, int version_major,
-           int version_minor, int version_patch) {
+           int version_minor, int version_patch, bool static_lib,
+           bool benches) {
 
     expect(starting_point < root.tus.size(),
            "starting point ({}) is out of range ({})", starting_point,
@@ -529,6 +1093,22 @@ impl fmt::Display for Error {{
                   "std::os::raw::c_char;\n}}\n\n",
                   project_name);
 
+    if (has_string_tables(root, starting_point)) {
+        write_string_table(out_lib);
+    }
+
+    if (has_pooled_records(root, starting_point)) {
+        write_arena(out_lib, project_name);
+    }
+
+    if (has_async_functions(root, starting_point)) {
+        write_task(out_lib, project_name);
+    }
+
+    if (has_instrumented_functions(root, starting_point)) {
+        write_stats(out_lib, project_name);
+    }
+
     const auto size = root.tus.size();
     for (size_t i = starting_point; i < size; ++i) {
         const auto& tu = root.tus[i];
@@ -568,17 +1148,33 @@ cmake = "0.1"
 )",
                     project_name, version_major, version_minor, version_patch);
 
+    if (benches && write_benches(out_dir, project_name, root, starting_point)) {
+        cargo_toml += R"(
+[dev-dependencies]
+criterion = "0.3"
+
+[[bench]]
+name = "bindings"
+harness = false
+)";
+    }
+
     auto out_cargo_toml = fmt::output_file(p_cargo_toml.string());
     out_cargo_toml.print(cargo_toml);
 
     auto build_rs = fmt::output_file((fs::path(out_dir) / "build.rs").string());
+    // A static C library pulls in its dependencies at the final link, so they
+    // must be linked the same way.
+    const char* link_kind = static_lib ? "static" : "dylib";
+
     build_rs.print(R"#(
 fn main() {{
     let dst = cmake::Config::new("{}").build();
     println!("cargo:rustc-link-search=native={{}}", dst.display());
-    println!("cargo:rustc-link-lib=dylib={}-c-{}_{}");
+    println!("cargo:rustc-link-lib={}={}-c-{}_{}");
 )#",
-                   c_dir, project_name, version_major, version_minor);
+                   c_dir, link_kind, project_name, version_major,
+                   version_minor);
 
     for (const auto& d : lib_dirs) {
         build_rs.print("    println!(\"cargo:rustc-link-search=native={}\");\n",
@@ -586,7 +1182,8 @@ fn main() {{
     }
 
     for (const auto& l : libs) {
-        build_rs.print("    println!(\"cargo:rustc-link-lib=dylib={}\");\n", l);
+        build_rs.print("    println!(\"cargo:rustc-link-lib={}={}\");\n",
+                       link_kind, l);
     }
 
     build_rs.print(R"(
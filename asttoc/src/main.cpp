@@ -45,6 +45,49 @@ static cl::list<std::string>
     opt_lib_dir("L", cl::desc("Directories you can find libraries in."),
                 cl::ZeroOrMore);
 
+static cl::opt<bool> opt_static(
+    "static",
+    cl::desc("Build the generated C library as a static library and link it, "
+             "along with the libraries given by -l, statically into the Rust "
+             "crate."));
+
+static cl::opt<bool> opt_unity_build(
+    "unity-build",
+    cl::desc("Batch the generated C library sources into unity builds."));
+
+static cl::opt<int> opt_unity_batch_size(
+    "unity-batch-size",
+    cl::desc("Number of sources in each unity build batch. 0 puts all the "
+             "sources in a single batch."),
+    cl::init(8));
+
+static cl::opt<bool> opt_pch(
+    "pch", cl::desc("Precompile the headers included by every generated C "
+                    "library source."));
+
+static cl::opt<bool> opt_split_headers(
+    "split-headers",
+    cl::desc("Also write a header for each record, enum and function pointer "
+             "to <project>/, declaring only what they use, and have the "
+             "generated headers include those. <project>/<project>.h "
+             "includes everything."));
+
+static cl::opt<bool> opt_no_exceptions(
+    "no-exceptions",
+    cl::desc("Don't catch exceptions in the generated wrappers and build the "
+             "generated C library with -fno-exceptions."));
+
+static cl::opt<bool> opt_instrument(
+    "instrument",
+    cl::desc("Count the calls to each generated wrapper. The counters are "
+             "compiled in with TLG_STATS, and latency histograms with "
+             "TLG_STATS_LATENCY, and read back with <project>_stats_dump()."));
+
+static cl::opt<bool> opt_benches(
+    "benches",
+    cl::desc("Add a Criterion benchmark of every wrapper that can be called "
+             "without any setup to the Rust crate, run with cargo bench."));
+
 static cl::opt<int> opt_verbosity(
     "v", cl::desc("Verbosity. 0=errors, 1=warnings, 2=info, 3=debug, 4=trace"),
     cl::init(1));
@@ -70,7 +113,10 @@ template <typename T> std::vector<std::string> to_vector(const T& t) {
 void generate(const char* input, const char* project_name, const char* output,
               const char* rust_output, const cppmm::Libs& libs,
               const cppmm::LibDirs& lib_dirs, int version_major,
-              int version_minor, int version_patch) {
+              int version_minor, int version_patch, bool static_lib,
+              bool unity_build, int unity_batch_size,
+              bool precompile_headers, bool exceptions, bool instrument,
+              bool benches, bool split_headers) {
     const std::string input_directory = input;
     const std::string output_directory = output;
 
@@ -79,25 +125,40 @@ void generate(const char* input, const char* project_name, const char* output,
 
     // Add the c translation units
     auto starting_point = cpp_ast.tus.size();
-    cppmm::transform::add_c(output_directory, cpp_ast);
+    cppmm::transform::add_c(project_name, output_directory, cpp_ast);
 
     // Save out only the c translation units
     std::string c_project_name = fmt::format("{}-c", project_name);
     cppmm::write::cerrors(output_directory.c_str(), cpp_ast, starting_point,
                           project_name);
-    cppmm::write::c(c_project_name.c_str(), cpp_ast, starting_point);
+    cppmm::write::cstringtable(output_directory.c_str(), cpp_ast,
+                               starting_point, project_name);
+    cppmm::write::ccast(output_directory.c_str(), cpp_ast, starting_point,
+                        project_name);
+    cppmm::write::cpool(output_directory.c_str(), cpp_ast, starting_point,
+                        project_name);
+    cppmm::write::ctask(output_directory.c_str(), cpp_ast, starting_point,
+                        project_name);
+    if (instrument) {
+        cppmm::write::cstats(output_directory.c_str(), cpp_ast, starting_point,
+                             project_name);
+    }
+    cppmm::write::c(c_project_name.c_str(), cpp_ast, starting_point,
+                    project_name, exceptions, split_headers);
 
     // Create a cmake file as well
     cppmm::write::cmake(c_project_name.c_str(), cpp_ast, starting_point, libs,
                         lib_dirs, version_major, version_minor, version_patch,
-                        project_name);
+                        project_name, static_lib, unity_build,
+                        unity_batch_size, precompile_headers, exceptions);
 
     std::string cwd = fs::current_path().string();
     std::string c_dir = pystring::os::path::abspath(output_directory, cwd);
 
     cppmm::rust_sys::write(rust_output, project_name, c_dir.c_str(), cpp_ast,
                            starting_point, libs, lib_dirs, version_major,
-                           version_minor, version_patch);
+                           version_minor, version_patch, static_lib,
+                           benches);
 }
 
 int main(int argc, char** argv) {
@@ -178,7 +239,9 @@ int main(int argc, char** argv) {
     auto lib_dirs = to_vector(opt_lib_dir);
     generate(opt_in_dir.c_str(), project_name.c_str(), c_dir.c_str(),
              rust_dir.c_str(), libs, lib_dirs, opt_version_major,
-             opt_version_minor, opt_version_patch);
+             opt_version_minor, opt_version_patch, opt_static, opt_unity_build,
+             opt_unity_batch_size, opt_pch, !opt_no_exceptions, opt_instrument,
+             opt_benches, opt_split_headers);
 
     return 0;
 }
@@ -26,6 +26,7 @@
 #include "llvm/Support/CommandLine.h"
 
 #include "base64.hpp"
+#include "cppmm_naming.hpp"
 #include "filesystem.hpp"
 #include "pystring.h"
 #include "resources.hpp"
@@ -983,11 +984,7 @@ NodeKind NodeTemplateTypeParmType::_kind = NodeKind::TemplateTypeParmType;
 
 /// Strip the type kinds off the front of a type name in the given string
 std::string strip_name_kinds(std::string s) {
-    s = pystring::replace(s, "class ", "");
-    s = pystring::replace(s, "struct ", "");
-    s = pystring::replace(s, "enum ", "");
-    s = pystring::replace(s, "union ", "");
-    return s;
+    return cppmm::naming::strip_name_kinds(s);
 }
 
 /// Get a nice, qualified name for the given record
@@ -2008,27 +2005,6 @@ std::vector<std::string> parse_project_includes(int argc, const char** argv) {
     return result;
 }
 
-// https://gist.github.com/rodamber/2558e25d4d8f6b9f2ffdf7bd49471340
-// FIXME: Handle multiple uppers by inserting an underscore before the last
-// upper. So IMFVersion becomes imf_version not imfversion
-std::string to_snake_case(std::string camel_case) {
-    std::string str(1, tolower(camel_case[0]));
-
-    // First place underscores between contiguous lower and upper case letters.
-    // For example, `_LowerCamelCase` becomes `_Lower_Camel_Case`.
-    for (auto it = camel_case.begin() + 1; it != camel_case.end(); ++it) {
-        if (isupper(*it) && *(it - 1) != '_' && islower(*(it - 1))) {
-            str += "_";
-        }
-        str += *it;
-    }
-
-    // Then convert it to lower case.
-    std::transform(str.begin(), str.end(), str.begin(), ::tolower);
-
-    return str;
-}
-
 //
 // list of includes for each input source file
 // this global is read in process_bindings.cpp
@@ -2236,10 +2212,11 @@ int main(int argc_, const char** argv_) {
             }
 
             // generate output filename by snake_casing the header filename
-            auto filename = to_snake_case(fs::path(node_tu->qualified_name)
-                                              .filename()
-                                              .replace_extension(".cpp")
-                                              .string());
+            auto filename = cppmm::naming::to_simple_snake_case(
+                fs::path(node_tu->qualified_name)
+                    .filename()
+                    .replace_extension(".cpp")
+                    .string());
             auto output_path = output_dir / fs::path(filename);
             std::ofstream of;
             of.open(output_path);
@@ -0,0 +1,300 @@
+//------------------------------------------------------------------------------
+// vfx-rs
+//------------------------------------------------------------------------------
+#pragma once
+
+// Name generation shared by astgen, genbind and asttoc.
+//
+// The append_* functions read their input through a StringRef and write to the
+// end of a caller-owned buffer, so a caller that reuses one buffer (or builds a
+// name in place from several pieces) does not allocate per call. The to_*
+// functions wrap them for the call sites that keep the result anyway.
+
+#include <llvm/ADT/StringMap.h>
+#include <llvm/ADT/StringRef.h>
+#include <llvm/ADT/StringSwitch.h>
+
+#include <cctype>
+#include <string>
+
+namespace cppmm {
+namespace naming {
+
+using llvm::StringRef;
+
+//------------------------------------------------------------------------------
+// Case conversion
+//------------------------------------------------------------------------------
+inline void append_pascal_case(StringRef s, std::string& out) {
+    const auto start = out.size();
+
+    bool brk = true;
+    bool waslower = true;
+    int wasupper = 0;
+    for (auto c_ : s) {
+        auto c = c_;
+        if (waslower && isupper(c)) {
+            brk = true;
+        }
+        if (wasupper > 1 && islower(c) && c != '_' && out.size() > start) {
+            out.back() = toupper(out.back());
+            wasupper = 0;
+        }
+        if (brk) {
+            c = toupper(c);
+            brk = false;
+        } else {
+            c = tolower(c);
+        }
+        if (c == '_') {
+            brk = true;
+            wasupper = 0;
+            continue;
+        }
+        out.push_back(c);
+
+        waslower = islower(c_);
+        if (isupper(c_)) {
+            wasupper++;
+        }
+    }
+}
+
+// Shared by snake and capital case, which differ only in the case of the
+// letters. Runs of capitals are kept together, so IMFVersion becomes
+// imf_version.
+template <typename F>
+void append_underscored(StringRef s, std::string& out, F convert) {
+    int wasupper = 0;
+    char lastc = '\0';
+    for (auto c : s) {
+        if (lastc == '\0') {
+            lastc = c;
+            continue;
+        }
+
+        if (lastc == '_') {
+            out.push_back(lastc);
+            wasupper = 0;
+        } else {
+            if (isupper(c) && islower(lastc)) {
+                out.push_back(convert(lastc));
+                out.push_back('_');
+                wasupper = 0;
+            } else if (wasupper > 1 && islower(c)) {
+                out.push_back('_');
+                out.push_back(convert(lastc));
+                wasupper = 0;
+            } else {
+                out.push_back(convert(lastc));
+            }
+        }
+
+        if (isupper(c)) {
+            wasupper++;
+        }
+
+        lastc = c;
+    }
+    out.push_back(convert(lastc));
+}
+
+inline void append_snake_case(StringRef s, std::string& out) {
+    append_underscored(s, out, [](char c) { return char(tolower(c)); });
+}
+
+inline void append_capital_case(StringRef s, std::string& out) {
+    append_underscored(s, out, [](char c) { return char(toupper(c)); });
+}
+
+// The older conversion genbind uses for its file names, which only splits
+// where a lower case letter is followed by an upper case one, so IMFVersion
+// becomes imfversion. Kept separate so those names don't change.
+inline void append_simple_snake_case(StringRef s, std::string& out) {
+    if (s.empty()) {
+        return;
+    }
+
+    out.push_back(tolower(s[0]));
+    for (size_t i = 1; i < s.size(); ++i) {
+        if (isupper(s[i]) && islower(s[i - 1])) {
+            out.push_back('_');
+        }
+        out.push_back(tolower(s[i]));
+    }
+}
+
+inline std::string to_pascal_case(StringRef s) {
+    std::string result;
+    result.reserve(s.size());
+    append_pascal_case(s, result);
+    return result;
+}
+
+inline std::string to_snake_case(StringRef s) {
+    std::string result;
+    result.reserve(s.size() + 4);
+    append_snake_case(s, result);
+    return result;
+}
+
+inline std::string to_capital_case(StringRef s) {
+    std::string result;
+    result.reserve(s.size() + 4);
+    append_capital_case(s, result);
+    return result;
+}
+
+inline std::string to_simple_snake_case(StringRef s) {
+    std::string result;
+    result.reserve(s.size() + 4);
+    append_simple_snake_case(s, result);
+    return result;
+}
+
+//------------------------------------------------------------------------------
+// C names
+//------------------------------------------------------------------------------
+
+// The C-friendly name of a destructor or operator, or name itself if it is
+// neither. The result refers either to a literal or to name.
+inline StringRef remap_special_method(StringRef name) {
+    if (name.empty()) {
+        return name;
+    }
+
+    // Destructor
+    if (name[0] == '~') {
+        return "dtor";
+    }
+
+    // Operators
+    if (!name.startswith("operator")) {
+        return name;
+    }
+
+    return llvm::StringSwitch<StringRef>(name.drop_front(8))
+        .Case("=", "_assign")
+        .Case("==", "_eq")
+        .Case("!=", "_ne")
+        .Case("++", "_op_inc")
+        .Case("--", "_op_dec")
+        .Case("+", "_op_add")
+        .Case("-", "_op_sub")
+        .Case("/", "_op_div")
+        .Case("*", "_op_mul")
+        .Case("^", "_op_xor")
+        .Case("%", "_op_mod")
+        .Case("[]", "_index")
+        .Case("+=", "_op_iadd")
+        .Case("-=", "_op_isub")
+        .Case("/=", "_op_idiv")
+        .Case("*=", "_op_imul")
+        .Case("%=", "_op_imod")
+        .Case("^=", "_op_ixor")
+        .Case("()", "_op_call")
+        .Default(name);
+}
+
+// Append name as a valid C identifier: special methods are remapped, the
+// punctuation of qualified and template names becomes '_' and spaces are
+// dropped
+inline void append_c_name(StringRef name, std::string& out) {
+    for (auto c : remap_special_method(name)) {
+        switch (c) {
+        case ':':
+        case ',':
+        case '*':
+        case '<':
+        case '>':
+        case '-':
+            out.push_back('_');
+            break;
+        case ' ':
+            break;
+        default:
+            out.push_back(c);
+        }
+    }
+}
+
+inline std::string to_c_name(StringRef name) {
+    std::string result;
+    result.reserve(name.size());
+    append_c_name(name, result);
+    return result;
+}
+
+// Append s with every occurrence of from replaced by to
+inline void append_replaced(StringRef s, char from, StringRef to,
+                            std::string& out) {
+    for (auto c : s) {
+        if (c == from) {
+            out.append(to.data(), to.size());
+        } else {
+            out.push_back(c);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// Type names
+//------------------------------------------------------------------------------
+
+// Append s with the "class ", "struct ", "enum " and "union " elaborations
+// clang puts in type names removed
+inline void append_stripped_name_kinds(StringRef s, std::string& out) {
+    static const StringRef kinds[] = {"class ", "struct ", "enum ", "union "};
+
+    size_t i = 0;
+    while (i < s.size()) {
+        bool stripped = false;
+        for (const auto& kind : kinds) {
+            if (s.substr(i).startswith(kind)) {
+                i += kind.size();
+                stripped = true;
+                break;
+            }
+        }
+        if (!stripped) {
+            out.push_back(s[i++]);
+        }
+    }
+}
+
+inline std::string strip_name_kinds(StringRef s) {
+    std::string result;
+    result.reserve(s.size());
+    append_stripped_name_kinds(s, result);
+    return result;
+}
+
+//------------------------------------------------------------------------------
+// NameCache
+//------------------------------------------------------------------------------
+
+// Memoizes generated names by key. Lookups take the key by StringRef so a hit
+// neither copies the key nor allocates, and the returned references stay
+// valid for the lifetime of the cache.
+class NameCache {
+    llvm::StringMap<std::string> m_names;
+
+public:
+    // The name stored for key. On a miss, make(out) is called to build it into
+    // an empty string first.
+    template <typename F> const std::string& get(StringRef key, F make) {
+        auto it = m_names.find(key);
+        if (it != m_names.end()) {
+            return it->second;
+        }
+
+        auto& name = m_names[key];
+        make(name);
+        return name;
+    }
+
+    size_t size() const { return m_names.size(); }
+};
+
+} // namespace naming
+} // namespace cppmm
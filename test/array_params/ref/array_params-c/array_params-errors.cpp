@@ -1,9 +1,10 @@
 #include "array_params-errors.h"
 #include "array_params-errors-private.h"
 
-thread_local std::string TLG_EXCEPTION_STRING;
+thread_local char TLG_EXCEPTION_STRING[TLG_EXCEPTION_STRING_SIZE]
+    __attribute__((tls_model("initial-exec")));
 
 const char* array_params_get_exception_string() {
-    return TLG_EXCEPTION_STRING.c_str();
+    return TLG_EXCEPTION_STRING;
 }
 
@@ -1,9 +1,10 @@
 #pragma once
+#include "array_params-export.h"
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-const char* array_params_get_exception_string();
+ARRAY_PARAMS_EXPORT const char* array_params_get_exception_string();
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,5 @@
+#pragma once
+
+#ifndef ARRAY_PARAMS_EXPORT
+#define ARRAY_PARAMS_EXPORT __attribute__((visibility("default")))
+#endif
@@ -1,5 +1,6 @@
 #include <c-array_params_private.h>
 
+#include "array_params-errors-private.h"
 #include <new>
 
 #include <stdexcept>
@@ -12,7 +13,7 @@ unsigned int imath__Matrix44_float__from_array(
         new (this_) imath::Matrix44<float>(a);
         return 0;
     } catch (std::exception& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
         return -1;
     }
 }
@@ -1,4 +1,5 @@
 #pragma once
+#include "array_params-export.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -11,20 +12,12 @@ typedef imath__Matrix44_float__t imath_M44f_t;
 
 
 
-unsigned int imath__Matrix44_float__from_array(
+ARRAY_PARAMS_EXPORT unsigned int imath__Matrix44_float__from_array(
     imath_M44f_t * this_
     , float const a[4][4]);
 #define imath_M44f_from_array imath__Matrix44_float__from_array
 
 
-
-
-
-
-
-
-
-
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,93 @@
+"""Generate a binding with extra asttoc options and build the C library
+
+Unlike runtest.py this doesn't compare against refs: it checks that the
+generated CMake project configures and builds with the given asttoc options,
+such as --pch or --unity-build, which only change the build files.
+
+With --split-headers, each generated <project>/<type>.h is also compiled on its
+own as C. With --driver, the given C source is also built against the generated
+library and run from output_dir, and must exit with 0.
+
+usage: buildtest.py astgen asttoc binding_dir output_dir project_name
+                    asttoc_args [--driver source] [astgen_args...]
+
+asttoc_args is a single space-separated string.
+"""
+import os
+import re
+import sys
+import subprocess
+import shutil
+
+astgen_exe = sys.argv[1]
+asttoc_exe = sys.argv[2]
+binding_dir = sys.argv[3]
+output_dir = sys.argv[4]
+project_name = sys.argv[5]
+asttoc_args = sys.argv[6].split()
+astgen_args = sys.argv[7:]
+
+driver = None
+if astgen_args[:1] == ['--driver']:
+    driver = os.path.abspath(astgen_args[1])
+    astgen_args = astgen_args[2:]
+
+
+def run(args, cwd=None, input=None):
+    print('Running ' + ' '.join(args))
+    result = subprocess.Popen(args, cwd=cwd, stderr=subprocess.STDOUT,
+                              stdout=subprocess.PIPE,
+                              stdin=None if input is None else subprocess.PIPE)
+    (stdout, _) = result.communicate(None if input is None else input.encode())
+    print(stdout.decode())
+
+    if result.returncode != 0:
+        print('{} exited with non-zero return code {}'.format(
+            args[0], result.returncode))
+        sys.exit(result.returncode)
+
+
+# Clean up an existing output directory and make sure it exists fresh
+shutil.rmtree(output_dir, ignore_errors=True)
+os.makedirs(output_dir)
+
+output_ast_dir = os.path.join(output_dir, 'ast')
+run([astgen_exe, binding_dir, '-o', output_ast_dir, '--'] + astgen_args)
+run([asttoc_exe, output_ast_dir, '-o', output_dir, '-p', project_name] +
+    asttoc_args)
+
+c_dir = os.path.join(output_dir, '%s-c' % project_name)
+build_dir = os.path.join(output_dir, 'build')
+run(['cmake', '-S', c_dir, '-B', build_dir])
+run(['cmake', '--build', build_dir])
+
+# Every split header has to stand on its own, so compile each one as the only
+# include of a C file
+if '--split-headers' in asttoc_args:
+    split_dir = os.path.join(c_dir, project_name)
+    for header in sorted(os.listdir(split_dir)):
+        run([os.environ.get('CC', 'cc'), '-fsyntax-only', '-Wall', '-Werror',
+             '-I', c_dir, '-x', 'c', '-'],
+            input='#include <{}/{}>\n'.format(project_name, header))
+
+if driver:
+    # The library's target name is only known to its own CMakeLists.txt
+    with open(os.path.join(c_dir, 'CMakeLists.txt')) as f:
+        libname = re.search(r'set\(LIBNAME (\S+)\)', f.read()).group(1)
+
+    driver_dir = os.path.join(output_dir, 'driver')
+    os.makedirs(driver_dir)
+    with open(os.path.join(driver_dir, 'CMakeLists.txt'), 'w') as f:
+        f.write('cmake_minimum_required(VERSION 3.5)\n'
+                'project(driver C CXX)\n'
+                'add_subdirectory({0} lib)\n'
+                'add_executable(driver {1})\n'
+                'target_include_directories(driver PRIVATE {0})\n'
+                'target_link_libraries(driver {2})\n'
+                'set_target_properties(driver PROPERTIES '
+                'LINKER_LANGUAGE CXX)\n'.format(c_dir, driver, libname))
+
+    driver_build_dir = os.path.join(driver_dir, 'build')
+    run(['cmake', '-S', driver_dir, '-B', driver_build_dir])
+    run(['cmake', '--build', driver_build_dir])
+    run([os.path.join(driver_build_dir, 'driver')], cwd=output_dir)
@@ -1,5 +1,6 @@
 #include <c-comments_private.h>
 
+#include "comments-errors-private.h"
 
 #include <stdexcept>
 
@@ -10,7 +11,7 @@ unsigned int comments__Class_method(
         (to_cpp(this_)) -> method();
         return 0;
     } catch (std::exception& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
         return -1;
     }
 }
@@ -20,7 +21,7 @@ unsigned int comments_function()
         comments::function();
         return 0;
     } catch (std::exception& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
         return -1;
     }
 }
@@ -1,4 +1,5 @@
 #pragma once
+#include "comments-export.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -11,25 +12,22 @@ typedef struct comments__Class_t_s {
 } __attribute__((aligned(1))) comments__Class_t;
 typedef comments__Class_t comments_Class_t;
 
+#define comments__Class_sizeof 1
+#define comments__Class_alignof 1
+#define comments_Class_sizeof comments__Class_sizeof
+#define comments_Class_alignof comments__Class_alignof
+
 
 
 /** This method doesn't do anything interesting at all */
-unsigned int comments__Class_method(
+COMMENTS_EXPORT unsigned int comments__Class_method(
     comments_Class_t * this_);
 #define comments_Class_method comments__Class_method
 
 
 
-
-
-
-
-
-
-
-
 /** This is a free function that also does nothing interesting */
-unsigned int comments_function();
+COMMENTS_EXPORT unsigned int comments_function();
 #ifdef __cplusplus
 }
 #endif
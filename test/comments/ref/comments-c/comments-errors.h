@@ -1,9 +1,10 @@
 #pragma once
+#include "comments-export.h"
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-const char* comments_get_exception_string();
+COMMENTS_EXPORT const char* comments_get_exception_string();
 
 #ifdef __cplusplus
 }
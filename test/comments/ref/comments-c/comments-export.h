@@ -0,0 +1,5 @@
+#pragma once
+
+#ifndef COMMENTS_EXPORT
+#define COMMENTS_EXPORT __attribute__((visibility("default")))
+#endif
@@ -12,6 +12,10 @@ pub struct comments__Class_t {
     _unused: [u8; 0],
 }
 
+pub const comments__Class_sizeof: usize = 1;
+pub const comments__Class_alignof: usize = 1;
+
+
 
 extern "C" {
 
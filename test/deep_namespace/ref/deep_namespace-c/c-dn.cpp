@@ -1,5 +1,6 @@
 #include <c-dn_private.h>
 
+#include "deep_namespace-errors-private.h"
 
 #include <stdexcept>
 
@@ -10,7 +11,7 @@ unsigned int DN__v2_2__Class__Struct_structMethod(
         (to_cpp(this_)) -> structMethod();
         return 0;
     } catch (std::exception& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
         return -1;
     }
 }
@@ -20,7 +21,7 @@ unsigned int DN_v2_2_someFunction()
         DN::v2_2::someFunction();
         return 0;
     } catch (std::exception& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
         return -1;
     }
 }
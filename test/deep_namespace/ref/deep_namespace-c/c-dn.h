@@ -1,4 +1,5 @@
 #pragma once
+#include "deep_namespace-export.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -16,6 +17,11 @@ typedef struct DN__v2_2__Class_t_s {
 } __attribute__((aligned(4))) DN__v2_2__Class_t;
 typedef DN__v2_2__Class_t DN_Class_t;
 
+#define DN__v2_2__Class_sizeof 8
+#define DN__v2_2__Class_alignof 4
+#define DN_Class_sizeof DN__v2_2__Class_sizeof
+#define DN_Class_alignof DN__v2_2__Class_alignof
+
 typedef struct DN__v2_2__Class__Struct_t_s {
     int a;
     float b;
@@ -26,37 +32,13 @@ typedef DN__v2_2__Class__Struct_t DN_Class_Struct_t;
 
 
 
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-unsigned int DN__v2_2__Class__Struct_structMethod(
+DEEP_NAMESPACE_EXPORT unsigned int DN__v2_2__Class__Struct_structMethod(
     DN_Class_Struct_t * this_);
 #define DN_Class_Struct_structMethod DN__v2_2__Class__Struct_structMethod
 
 
 
-
-
-
-
-
-
-
-
-unsigned int DN_v2_2_someFunction();
+DEEP_NAMESPACE_EXPORT unsigned int DN_v2_2_someFunction();
 #define DN_someFunction DN_v2_2_someFunction
 
 #ifdef __cplusplus
@@ -2,63 +2,15 @@
 #include <c-dn.h>
 
 
-#include "deep_namespace-errors-private.h"
-
+#include "deep_namespace-cast-private.h"
 #include <cstring>
 #include <dn.hpp>
 
+namespace cppmm {
+template <> struct cast_from_c<DN_Class_t> : cast<DN_Class_t, DN::v2_2::Class> {};
+template <> struct cast_from_c<DN_Class_Struct_t> : cast<DN_Class_Struct_t, DN::v2_2::Class::Struct> {};
+} // namespace cppmm
 
-inline DN::v2_2::Class::Enum const & DN_Class_Enum_to_cpp_ref(
-    DN_Class_Enum const * rhs)
-{
-        return *(reinterpret_cast<DN::v2_2::Class::Enum const * >(rhs));
-}
-
-inline DN::v2_2::Class::Enum & DN_Class_Enum_to_cpp_ref(
-    DN_Class_Enum * rhs)
-{
-        return *(reinterpret_cast<DN::v2_2::Class::Enum * >(rhs));
-}
-
-inline DN::v2_2::Class::Enum const * DN_Class_Enum_to_cpp(
-    DN_Class_Enum const * rhs)
-{
-        return reinterpret_cast<DN::v2_2::Class::Enum const * >(rhs);
-}
-
-inline DN::v2_2::Class::Enum * DN_Class_Enum_to_cpp(
-    DN_Class_Enum * rhs)
-{
-        return reinterpret_cast<DN::v2_2::Class::Enum * >(rhs);
-}
-
-inline void to_c(
-    DN_Class_Enum const * * lhs
-    , DN::v2_2::Class::Enum const & rhs)
-{
-        *(lhs) = reinterpret_cast<DN_Class_Enum const * >(&(rhs));
-}
-
-inline void to_c(
-    DN_Class_Enum const * * lhs
-    , DN::v2_2::Class::Enum const * rhs)
-{
-        *(lhs) = reinterpret_cast<DN_Class_Enum const * >(rhs);
-}
-
-inline void to_c(
-    DN_Class_Enum * * lhs
-    , DN::v2_2::Class::Enum & rhs)
-{
-        *(lhs) = reinterpret_cast<DN_Class_Enum * >(&(rhs));
-}
-
-inline void to_c(
-    DN_Class_Enum * * lhs
-    , DN::v2_2::Class::Enum * rhs)
-{
-        *(lhs) = reinterpret_cast<DN_Class_Enum * >(rhs);
-}
 
 inline void to_c_copy(
     DN_Class_Enum * lhs
@@ -67,58 +19,6 @@ inline void to_c_copy(
         memcpy(lhs, &(rhs), sizeof(*(lhs)));
 }
 
-inline DN::v2_2::Class const & to_cpp_ref(
-    DN_Class_t const * rhs)
-{
-        return *(reinterpret_cast<DN::v2_2::Class const * >(rhs));
-}
-
-inline DN::v2_2::Class & to_cpp_ref(
-    DN_Class_t * rhs)
-{
-        return *(reinterpret_cast<DN::v2_2::Class * >(rhs));
-}
-
-inline DN::v2_2::Class const * to_cpp(
-    DN_Class_t const * rhs)
-{
-        return reinterpret_cast<DN::v2_2::Class const * >(rhs);
-}
-
-inline DN::v2_2::Class * to_cpp(
-    DN_Class_t * rhs)
-{
-        return reinterpret_cast<DN::v2_2::Class * >(rhs);
-}
-
-inline void to_c(
-    DN_Class_t const * * lhs
-    , DN::v2_2::Class const & rhs)
-{
-        *(lhs) = reinterpret_cast<DN_Class_t const * >(&(rhs));
-}
-
-inline void to_c(
-    DN_Class_t const * * lhs
-    , DN::v2_2::Class const * rhs)
-{
-        *(lhs) = reinterpret_cast<DN_Class_t const * >(rhs);
-}
-
-inline void to_c(
-    DN_Class_t * * lhs
-    , DN::v2_2::Class & rhs)
-{
-        *(lhs) = reinterpret_cast<DN_Class_t * >(&(rhs));
-}
-
-inline void to_c(
-    DN_Class_t * * lhs
-    , DN::v2_2::Class * rhs)
-{
-        *(lhs) = reinterpret_cast<DN_Class_t * >(rhs);
-}
-
 inline void to_c_copy(
     DN_Class_t * lhs
     , DN::v2_2::Class const & rhs)
@@ -127,58 +27,6 @@ inline void to_c_copy(
 }
 
 
-inline DN::v2_2::Class::Struct const & to_cpp_ref(
-    DN_Class_Struct_t const * rhs)
-{
-        return *(reinterpret_cast<DN::v2_2::Class::Struct const * >(rhs));
-}
-
-inline DN::v2_2::Class::Struct & to_cpp_ref(
-    DN_Class_Struct_t * rhs)
-{
-        return *(reinterpret_cast<DN::v2_2::Class::Struct * >(rhs));
-}
-
-inline DN::v2_2::Class::Struct const * to_cpp(
-    DN_Class_Struct_t const * rhs)
-{
-        return reinterpret_cast<DN::v2_2::Class::Struct const * >(rhs);
-}
-
-inline DN::v2_2::Class::Struct * to_cpp(
-    DN_Class_Struct_t * rhs)
-{
-        return reinterpret_cast<DN::v2_2::Class::Struct * >(rhs);
-}
-
-inline void to_c(
-    DN_Class_Struct_t const * * lhs
-    , DN::v2_2::Class::Struct const & rhs)
-{
-        *(lhs) = reinterpret_cast<DN_Class_Struct_t const * >(&(rhs));
-}
-
-inline void to_c(
-    DN_Class_Struct_t const * * lhs
-    , DN::v2_2::Class::Struct const * rhs)
-{
-        *(lhs) = reinterpret_cast<DN_Class_Struct_t const * >(rhs);
-}
-
-inline void to_c(
-    DN_Class_Struct_t * * lhs
-    , DN::v2_2::Class::Struct & rhs)
-{
-        *(lhs) = reinterpret_cast<DN_Class_Struct_t * >(&(rhs));
-}
-
-inline void to_c(
-    DN_Class_Struct_t * * lhs
-    , DN::v2_2::Class::Struct * rhs)
-{
-        *(lhs) = reinterpret_cast<DN_Class_Struct_t * >(rhs);
-}
-
 inline void to_c_copy(
     DN_Class_Struct_t * lhs
     , DN::v2_2::Class::Struct const & rhs)
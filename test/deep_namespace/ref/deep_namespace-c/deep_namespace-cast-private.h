@@ -0,0 +1,80 @@
+#pragma once
+
+namespace cppmm {
+
+// The conversions between a c type and the cpp type it wraps. The c type is
+// either the storage for the cpp object or an opaque handle to it, so every
+// conversion is a reinterpret_cast.
+template <typename C, typename Cpp> struct cast {
+    using c_type = C;
+    using cpp_type = Cpp;
+
+    static Cpp const* to_cpp(C const* rhs) {
+        return reinterpret_cast<Cpp const*>(rhs);
+    }
+    static Cpp* to_cpp(C* rhs) { return reinterpret_cast<Cpp*>(rhs); }
+
+    static Cpp const& to_cpp_ref(C const* rhs) { return *to_cpp(rhs); }
+    static Cpp& to_cpp_ref(C* rhs) { return *to_cpp(rhs); }
+
+    static void to_c(C const** lhs, Cpp const& rhs) {
+        *lhs = reinterpret_cast<C const*>(&rhs);
+    }
+    static void to_c(C const** lhs, Cpp const* rhs) {
+        *lhs = reinterpret_cast<C const*>(rhs);
+    }
+    static void to_c(C** lhs, Cpp& rhs) { *lhs = reinterpret_cast<C*>(&rhs); }
+    static void to_c(C** lhs, Cpp* rhs) { *lhs = reinterpret_cast<C*>(rhs); }
+};
+
+// Specialised in the private headers to derive from the cast for each
+// record's c type, which is how the functions below find it. Types that
+// aren't records have no cpp_type here, which takes them out of overload
+// resolution.
+template <typename C> struct cast_from_c {};
+
+} // namespace cppmm
+
+template <typename C>
+typename cppmm::cast_from_c<C>::cpp_type const* to_cpp(C const* rhs) {
+    return cppmm::cast_from_c<C>::to_cpp(rhs);
+}
+
+template <typename C>
+typename cppmm::cast_from_c<C>::cpp_type* to_cpp(C* rhs) {
+    return cppmm::cast_from_c<C>::to_cpp(rhs);
+}
+
+template <typename C>
+typename cppmm::cast_from_c<C>::cpp_type const& to_cpp_ref(C const* rhs) {
+    return cppmm::cast_from_c<C>::to_cpp_ref(rhs);
+}
+
+template <typename C>
+typename cppmm::cast_from_c<C>::cpp_type& to_cpp_ref(C* rhs) {
+    return cppmm::cast_from_c<C>::to_cpp_ref(rhs);
+}
+
+// The cpp type isn't deduced, so that a derived object converts to the base
+// the c type wraps just as it would when passed to a function taking a base.
+template <typename C>
+void to_c(C const** lhs,
+          typename cppmm::cast_from_c<C>::cpp_type const& rhs) {
+    cppmm::cast_from_c<C>::to_c(lhs, rhs);
+}
+
+template <typename C>
+void to_c(C const** lhs,
+          typename cppmm::cast_from_c<C>::cpp_type const* rhs) {
+    cppmm::cast_from_c<C>::to_c(lhs, rhs);
+}
+
+template <typename C>
+void to_c(C** lhs, typename cppmm::cast_from_c<C>::cpp_type& rhs) {
+    cppmm::cast_from_c<C>::to_c(lhs, rhs);
+}
+
+template <typename C>
+void to_c(C** lhs, typename cppmm::cast_from_c<C>::cpp_type* rhs) {
+    cppmm::cast_from_c<C>::to_c(lhs, rhs);
+}
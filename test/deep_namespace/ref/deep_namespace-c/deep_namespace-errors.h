@@ -1,9 +1,10 @@
 #pragma once
+#include "deep_namespace-export.h"
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-const char* deep_namespace_get_exception_string();
+DEEP_NAMESPACE_EXPORT const char* deep_namespace_get_exception_string();
 
 #ifdef __cplusplus
 }
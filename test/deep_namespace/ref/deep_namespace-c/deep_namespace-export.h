@@ -0,0 +1,5 @@
+#pragma once
+
+#ifndef DEEP_NAMESPACE_EXPORT
+#define DEEP_NAMESPACE_EXPORT __attribute__((visibility("default")))
+#endif
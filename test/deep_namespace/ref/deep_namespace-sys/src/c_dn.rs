@@ -9,6 +9,10 @@ use std::os::raw::*;
 pub struct DN__v2_2__Class_t {
     _unused: [u8; 0],
 }
+
+pub const DN__v2_2__Class_sizeof: usize = 8;
+pub const DN__v2_2__Class_alignof: usize = 4;
+
 #[repr(C, align(4))]
 #[derive(Clone)]
 pub struct DN__v2_2__Class__Struct_t {
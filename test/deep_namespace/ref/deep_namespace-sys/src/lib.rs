@@ -43,6 +43,8 @@ extern {
 
 pub mod c_dn;
 pub use c_dn::DN__v2_2__Class_t as DN_Class_t;
+pub use c_dn::DN__v2_2__Class_sizeof as DN_Class_sizeof;
+pub use c_dn::DN__v2_2__Class_alignof as DN_Class_alignof;
 pub use c_dn::DN__v2_2__Class__Struct_t as DN_Class_Struct_t;
 
 pub use c_dn::DN__v2_2__Class__Enum_e as DN_Class_Enum;
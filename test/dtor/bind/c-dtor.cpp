@@ -12,6 +12,18 @@ struct Struct {
     ~Struct();
 } CPPMM_OPAQUEBYTES;
 
+struct Buffer {
+    using BoundType = ::dtor::Buffer;
+    Buffer() CPPMM_RENAME(ctor);
+    CPPMM_MOVE(::dtor, Buffer)
+    ~Buffer();
+
+    void append(::std::string&& s);
+    const ::std::string& contents() const;
+    ::dtor::Buffer split();
+    ::dtor::Buffer&& take();
+} CPPMM_OPAQUEPTR;
+
 } // namespace dtor
 
 } // namespace cppmm_bind
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <utility>
 
 namespace dtor {
 
@@ -13,4 +14,28 @@ struct Struct {
     ~Struct() {}
 };
 
+// Move-only, so it can only cross the boundary by moving
+struct Buffer {
+    std::string data;
+
+    Buffer() {}
+    Buffer(Buffer&& rhs) : data(std::move(rhs.data)) {}
+    Buffer& operator=(Buffer&& rhs) {
+        data = std::move(rhs.data);
+        return *this;
+    }
+    ~Buffer() {}
+
+    void append(std::string&& s) { data += s; }
+    const std::string& contents() const { return data; }
+
+    // Hand the contents over to a new Buffer, leaving this one empty
+    Buffer split() {
+        Buffer result;
+        std::swap(result.data, data);
+        return result;
+    }
+    Buffer&& take() { return std::move(*this); }
+};
+
 }; // namespace dtor
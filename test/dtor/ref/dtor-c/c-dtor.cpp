@@ -1,6 +1,9 @@
 #include <c-dtor_private.h>
 
+#include "dtor-errors-private.h"
 #include <new>
+#include <std_string_private.h>
+#include <utility>
 
 #include <stdexcept>
 
@@ -11,7 +14,18 @@ unsigned int dtor__Struct_Struct(
         to_c(this_, new dtor::Struct());
         return 0;
     } catch (std::exception& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
+        return -1;
+    }
+}
+unsigned int dtor__Struct_Struct_in_place(
+    dtor_Struct_t * this_)
+{
+    try {
+        new (this_) dtor::Struct();
+        return 0;
+    } catch (std::exception& e) {
+        tlg_set_exception_string(e.what());
         return -1;
     }
 }
@@ -22,7 +36,147 @@ unsigned int dtor__Struct_dtor(
         delete to_cpp(this_);
         return 0;
     } catch (std::exception& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
+        return -1;
+    }
+}
+unsigned int dtor__Struct_drop_in_place(
+    dtor_Struct_t * this_)
+{
+    try {
+        (to_cpp(this_)) -> dtor::Struct::~Struct();
+        return 0;
+    } catch (std::exception& e) {
+        tlg_set_exception_string(e.what());
+        return -1;
+    }
+}
+unsigned int dtor__Buffer_ctor(
+    dtor_Buffer_t * * this_)
+{
+    try {
+        to_c(this_, new dtor::Buffer());
+        return 0;
+    } catch (std::exception& e) {
+        tlg_set_exception_string(e.what());
+        return -1;
+    }
+}
+unsigned int dtor__Buffer_ctor_in_place(
+    dtor_Buffer_t * this_)
+{
+    try {
+        new (this_) dtor::Buffer();
+        return 0;
+    } catch (std::exception& e) {
+        tlg_set_exception_string(e.what());
+        return -1;
+    }
+}
+unsigned int dtor__Buffer_move(
+    dtor_Buffer_t * * this_
+    , dtor_Buffer_t * rhs)
+{
+    try {
+        to_c(this_, new dtor::Buffer(std::move(to_cpp_ref(rhs))));
+        return 0;
+    } catch (std::exception& e) {
+        tlg_set_exception_string(e.what());
+        return -1;
+    }
+}
+unsigned int dtor__Buffer_move_in_place(
+    dtor_Buffer_t * this_
+    , dtor_Buffer_t * rhs)
+{
+    try {
+        new (this_) dtor::Buffer(std::move(to_cpp_ref(rhs)));
+        return 0;
+    } catch (std::exception& e) {
+        tlg_set_exception_string(e.what());
+        return -1;
+    }
+}
+unsigned int dtor__Buffer_move_assign(
+    dtor_Buffer_t * this_
+    , dtor_Buffer_t * * return_
+    , dtor_Buffer_t * rhs)
+{
+    try {
+        to_c(return_, (to_cpp(this_)) -> operator=(std::move(to_cpp_ref(rhs))));
+        return 0;
+    } catch (std::exception& e) {
+        tlg_set_exception_string(e.what());
+        return -1;
+    }
+}
+unsigned int dtor__Buffer_dtor(
+    dtor_Buffer_t * this_)
+{
+    try {
+        delete to_cpp(this_);
+        return 0;
+    } catch (std::exception& e) {
+        tlg_set_exception_string(e.what());
+        return -1;
+    }
+}
+unsigned int dtor__Buffer_drop_in_place(
+    dtor_Buffer_t * this_)
+{
+    try {
+        (to_cpp(this_)) -> dtor::Buffer::~Buffer();
+        return 0;
+    } catch (std::exception& e) {
+        tlg_set_exception_string(e.what());
+        return -1;
+    }
+}
+unsigned int dtor__Buffer_append(
+    dtor_Buffer_t * this_
+    , std___cxx11_string_t * s)
+{
+    try {
+        (to_cpp(this_)) -> append(std::move(to_cpp_ref(s)));
+        return 0;
+    } catch (std::exception& e) {
+        tlg_set_exception_string(e.what());
+        return -1;
+    }
+}
+unsigned int dtor__Buffer_contents(
+    dtor_Buffer_t const * this_
+    , std___cxx11_string_t const * * return_)
+{
+    try {
+        to_c(return_, (to_cpp(this_)) -> contents());
+        return 0;
+    } catch (std::exception& e) {
+        tlg_set_exception_string(e.what());
+        return -1;
+    }
+}
+unsigned int dtor__Buffer_split(
+    dtor_Buffer_t * this_
+    , dtor_Buffer_t * * return_)
+{
+    try {
+        to_c_copy(return_, (to_cpp(this_)) -> split());
+        return 0;
+    } catch (std::exception& e) {
+        tlg_set_exception_string(e.what());
+        return -1;
+    }
+}
+unsigned int dtor__Buffer_take(
+    dtor_Buffer_t * this_
+    , dtor_Buffer_t * * return_)
+{
+    try {
+        to_c_copy(return_, (to_cpp(this_)) -> take());
+        return 0;
+    } catch (std::exception& e) {
+        tlg_set_exception_string(e.what());
         return -1;
     }
 }
@@ -1,31 +1,121 @@
 #pragma once
+#include "dtor-export.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+typedef struct std____cxx11__basic_string_char__t_s std____cxx11__basic_string_char__t;
+typedef std____cxx11__basic_string_char__t std___cxx11_string_t;
+
 typedef struct dtor__Struct_t_s {
     char _unused;
 } __attribute__((aligned(8))) dtor__Struct_t;
 typedef dtor__Struct_t dtor_Struct_t;
 
+#define dtor__Struct_sizeof 48
+#define dtor__Struct_alignof 8
+#define dtor_Struct_sizeof dtor__Struct_sizeof
+#define dtor_Struct_alignof dtor__Struct_alignof
+
+typedef struct dtor__Buffer_t_s {
+    char _unused;
+} __attribute__((aligned(8))) dtor__Buffer_t;
+typedef dtor__Buffer_t dtor_Buffer_t;
+
+#define dtor__Buffer_sizeof 32
+#define dtor__Buffer_alignof 8
+#define dtor_Buffer_sizeof dtor__Buffer_sizeof
+#define dtor_Buffer_alignof dtor__Buffer_alignof
 
 
-unsigned int dtor__Struct_Struct(
+
+DTOR_EXPORT unsigned int dtor__Struct_Struct(
     dtor_Struct_t * * this_);
 #define dtor_Struct_Struct dtor__Struct_Struct
 
 
-unsigned int dtor__Struct_dtor(
+/** Like dtor_Struct_Struct, but constructs into this_, which must point to dtor_Struct_sizeof bytes aligned to dtor_Struct_alignof */
+DTOR_EXPORT unsigned int dtor__Struct_Struct_in_place(
+    dtor_Struct_t * this_);
+#define dtor_Struct_Struct_in_place dtor__Struct_Struct_in_place
+
+
+DTOR_EXPORT unsigned int dtor__Struct_dtor(
     dtor_Struct_t * this_);
 #define dtor_Struct_dtor dtor__Struct_dtor
 
 
+/** Like dtor_Struct_dtor, but leaves the storage at this_ to the caller */
+DTOR_EXPORT unsigned int dtor__Struct_drop_in_place(
+    dtor_Struct_t * this_);
+#define dtor_Struct_drop_in_place dtor__Struct_drop_in_place
+
+
+DTOR_EXPORT unsigned int dtor__Buffer_ctor(
+    dtor_Buffer_t * * this_);
+#define dtor_Buffer_ctor dtor__Buffer_ctor
+
+
+/** Like dtor_Buffer_ctor, but constructs into this_, which must point to dtor_Buffer_sizeof bytes aligned to dtor_Buffer_alignof */
+DTOR_EXPORT unsigned int dtor__Buffer_ctor_in_place(
+    dtor_Buffer_t * this_);
+#define dtor_Buffer_ctor_in_place dtor__Buffer_ctor_in_place
+
+
+DTOR_EXPORT unsigned int dtor__Buffer_move(
+    dtor_Buffer_t * * this_
+    , dtor_Buffer_t * rhs);
+#define dtor_Buffer_move dtor__Buffer_move
+
+
+/** Like dtor_Buffer_move, but constructs into this_, which must point to dtor_Buffer_sizeof bytes aligned to dtor_Buffer_alignof */
+DTOR_EXPORT unsigned int dtor__Buffer_move_in_place(
+    dtor_Buffer_t * this_
+    , dtor_Buffer_t * rhs);
+#define dtor_Buffer_move_in_place dtor__Buffer_move_in_place
+
+
+DTOR_EXPORT unsigned int dtor__Buffer_move_assign(
+    dtor_Buffer_t * this_
+    , dtor_Buffer_t * * return_
+    , dtor_Buffer_t * rhs);
+#define dtor_Buffer_move_assign dtor__Buffer_move_assign
+
+
+DTOR_EXPORT unsigned int dtor__Buffer_dtor(
+    dtor_Buffer_t * this_);
+#define dtor_Buffer_dtor dtor__Buffer_dtor
+
+
+/** Like dtor_Buffer_dtor, but leaves the storage at this_ to the caller */
+DTOR_EXPORT unsigned int dtor__Buffer_drop_in_place(
+    dtor_Buffer_t * this_);
+#define dtor_Buffer_drop_in_place dtor__Buffer_drop_in_place
+
+
+DTOR_EXPORT unsigned int dtor__Buffer_append(
+    dtor_Buffer_t * this_
+    , std___cxx11_string_t * s);
+#define dtor_Buffer_append dtor__Buffer_append
+
 
+DTOR_EXPORT unsigned int dtor__Buffer_contents(
+    dtor_Buffer_t const * this_
+    , std___cxx11_string_t const * * return_);
+#define dtor_Buffer_contents dtor__Buffer_contents
 
 
+DTOR_EXPORT unsigned int dtor__Buffer_split(
+    dtor_Buffer_t * this_
+    , dtor_Buffer_t * * return_);
+#define dtor_Buffer_split dtor__Buffer_split
 
 
+DTOR_EXPORT unsigned int dtor__Buffer_take(
+    dtor_Buffer_t * this_
+    , dtor_Buffer_t * * return_);
+#define dtor_Buffer_take dtor__Buffer_take
 
 
 #ifdef __cplusplus
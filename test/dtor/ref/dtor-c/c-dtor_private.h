@@ -2,62 +2,33 @@
 #include <c-dtor.h>
 
 
-#include "dtor-errors-private.h"
-
-#include <cstring>
+#include "dtor-cast-private.h"
 #include <dtor.hpp>
 
+namespace cppmm {
+template <> struct cast_from_c<dtor_Struct_t> : cast<dtor_Struct_t, dtor::Struct> {};
+template <> struct cast_from_c<dtor_Buffer_t> : cast<dtor_Buffer_t, dtor::Buffer> {};
+} // namespace cppmm
+
+
+
+
+
+
+
 
 
 
-inline dtor::Struct const & to_cpp_ref(
-    dtor_Struct_t const * rhs)
-{
-        return *(reinterpret_cast<dtor::Struct const * >(rhs));
-}
 
-inline dtor::Struct & to_cpp_ref(
-    dtor_Struct_t * rhs)
-{
-        return *(reinterpret_cast<dtor::Struct * >(rhs));
-}
 
-inline dtor::Struct const * to_cpp(
-    dtor_Struct_t const * rhs)
-{
-        return reinterpret_cast<dtor::Struct const * >(rhs);
-}
 
-inline dtor::Struct * to_cpp(
-    dtor_Struct_t * rhs)
-{
-        return reinterpret_cast<dtor::Struct * >(rhs);
-}
 
-inline void to_c(
-    dtor_Struct_t const * * lhs
-    , dtor::Struct const & rhs)
-{
-        *(lhs) = reinterpret_cast<dtor_Struct_t const * >(&(rhs));
-}
 
-inline void to_c(
-    dtor_Struct_t const * * lhs
-    , dtor::Struct const * rhs)
-{
-        *(lhs) = reinterpret_cast<dtor_Struct_t const * >(rhs);
-}
 
-inline void to_c(
-    dtor_Struct_t * * lhs
-    , dtor::Struct & rhs)
-{
-        *(lhs) = reinterpret_cast<dtor_Struct_t * >(&(rhs));
-}
 
-inline void to_c(
-    dtor_Struct_t * * lhs
-    , dtor::Struct * rhs)
+inline void to_c_copy(
+    dtor_Buffer_t * * lhs
+    , dtor::Buffer && rhs)
 {
-        *(lhs) = reinterpret_cast<dtor_Struct_t * >(rhs);
+        dtor__Buffer_move(lhs, reinterpret_cast<dtor_Buffer_t * >(&(rhs)));
 }
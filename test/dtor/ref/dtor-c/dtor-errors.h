@@ -1,9 +1,10 @@
 #pragma once
+#include "dtor-export.h"
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-const char* dtor_get_exception_string();
+DTOR_EXPORT const char* dtor_get_exception_string();
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,5 @@
+#pragma once
+
+#ifndef DTOR_EXPORT
+#define DTOR_EXPORT __attribute__((visibility("default")))
+#endif
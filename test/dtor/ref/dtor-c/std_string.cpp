@@ -1,5 +1,6 @@
 #include <std_string_private.h>
 
+#include "dtor-errors-private.h"
 #include <new>
 
 #include <stdexcept>
@@ -11,7 +12,18 @@ unsigned int std____cxx11__basic_string_char__ctor(
         to_c(this_, new std::__cxx11::basic_string<char>());
         return 0;
     } catch (std::exception& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
+        return -1;
+    }
+}
+unsigned int std____cxx11__basic_string_char__ctor_in_place(
+    std___cxx11_string_t * this_)
+{
+    try {
+        new (this_) std::__cxx11::basic_string<char>();
+        return 0;
+    } catch (std::exception& e) {
+        tlg_set_exception_string(e.what());
         return -1;
     }
 }
@@ -23,7 +35,19 @@ unsigned int std____cxx11__basic_string_char__copy(
         to_c(this_, new std::__cxx11::basic_string<char>(to_cpp_ref(rhs)));
         return 0;
     } catch (std::exception& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
+        return -1;
+    }
+}
+unsigned int std____cxx11__basic_string_char__copy_in_place(
+    std___cxx11_string_t * this_
+    , std___cxx11_string_t const * rhs)
+{
+    try {
+        new (this_) std::__cxx11::basic_string<char>(to_cpp_ref(rhs));
+        return 0;
+    } catch (std::exception& e) {
+        tlg_set_exception_string(e.what());
         return -1;
     }
 }
@@ -34,7 +58,18 @@ unsigned int std____cxx11__basic_string_char__dtor(
         delete to_cpp(this_);
         return 0;
     } catch (std::exception& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
+        return -1;
+    }
+}
+unsigned int std____cxx11__basic_string_char__drop_in_place(
+    std___cxx11_string_t * this_)
+{
+    try {
+        (to_cpp(this_)) -> std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >::~basic_string();
+        return 0;
+    } catch (std::exception& e) {
+        tlg_set_exception_string(e.what());
         return -1;
     }
 }
@@ -48,7 +83,7 @@ unsigned int std____cxx11__basic_string_char__assign(
         to_c(return_, (to_cpp(this_)) -> assign(s, count));
         return 0;
     } catch (std::exception& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
         return -1;
     }
 }
@@ -60,7 +95,7 @@ unsigned int std____cxx11__basic_string_char__c_str(
         *(return_) = (to_cpp(this_)) -> c_str();
         return 0;
     } catch (std::exception& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
         return -1;
     }
 }
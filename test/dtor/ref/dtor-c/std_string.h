@@ -1,4 +1,5 @@
 #pragma once
+#include "dtor-export.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -9,25 +10,49 @@ typedef struct std____cxx11__basic_string_char__t_s {
 } __attribute__((aligned(8))) std____cxx11__basic_string_char__t;
 typedef std____cxx11__basic_string_char__t std___cxx11_string_t;
 
+#define std____cxx11__basic_string_char__sizeof 32
+#define std____cxx11__basic_string_char__alignof 8
+#define std___cxx11_string_sizeof std____cxx11__basic_string_char__sizeof
+#define std___cxx11_string_alignof std____cxx11__basic_string_char__alignof
 
 
-unsigned int std____cxx11__basic_string_char__ctor(
+
+DTOR_EXPORT unsigned int std____cxx11__basic_string_char__ctor(
     std___cxx11_string_t * * this_);
 #define std___cxx11_string_ctor std____cxx11__basic_string_char__ctor
 
 
-unsigned int std____cxx11__basic_string_char__copy(
+/** Like std___cxx11_string_ctor, but constructs into this_, which must point to std___cxx11_string_sizeof bytes aligned to std___cxx11_string_alignof */
+DTOR_EXPORT unsigned int std____cxx11__basic_string_char__ctor_in_place(
+    std___cxx11_string_t * this_);
+#define std___cxx11_string_ctor_in_place std____cxx11__basic_string_char__ctor_in_place
+
+
+DTOR_EXPORT unsigned int std____cxx11__basic_string_char__copy(
     std___cxx11_string_t * * this_
     , std___cxx11_string_t const * rhs);
 #define std___cxx11_string_copy std____cxx11__basic_string_char__copy
 
 
-unsigned int std____cxx11__basic_string_char__dtor(
+/** Like std___cxx11_string_copy, but constructs into this_, which must point to std___cxx11_string_sizeof bytes aligned to std___cxx11_string_alignof */
+DTOR_EXPORT unsigned int std____cxx11__basic_string_char__copy_in_place(
+    std___cxx11_string_t * this_
+    , std___cxx11_string_t const * rhs);
+#define std___cxx11_string_copy_in_place std____cxx11__basic_string_char__copy_in_place
+
+
+DTOR_EXPORT unsigned int std____cxx11__basic_string_char__dtor(
     std___cxx11_string_t * this_);
 #define std___cxx11_string_dtor std____cxx11__basic_string_char__dtor
 
 
-unsigned int std____cxx11__basic_string_char__assign(
+/** Like std___cxx11_string_dtor, but leaves the storage at this_ to the caller */
+DTOR_EXPORT unsigned int std____cxx11__basic_string_char__drop_in_place(
+    std___cxx11_string_t * this_);
+#define std___cxx11_string_drop_in_place std____cxx11__basic_string_char__drop_in_place
+
+
+DTOR_EXPORT unsigned int std____cxx11__basic_string_char__assign(
     std___cxx11_string_t * this_
     , std___cxx11_string_t * * return_
     , char const * s
@@ -35,20 +60,12 @@ unsigned int std____cxx11__basic_string_char__assign(
 #define std___cxx11_string_assign std____cxx11__basic_string_char__assign
 
 
-unsigned int std____cxx11__basic_string_char__c_str(
+DTOR_EXPORT unsigned int std____cxx11__basic_string_char__c_str(
     std___cxx11_string_t const * this_
     , char const * * return_);
 #define std___cxx11_string_c_str std____cxx11__basic_string_char__c_str
 
 
-
-
-
-
-
-
-
-
 #ifdef __cplusplus
 }
 #endif
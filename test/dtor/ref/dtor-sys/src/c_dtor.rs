@@ -10,12 +10,55 @@ pub struct dtor__Struct_t {
     _unused: [u8; 0],
 }
 
+pub const dtor__Struct_sizeof: usize = 48;
+pub const dtor__Struct_alignof: usize = 8;
+
+#[repr(C)]
+pub struct dtor__Buffer_t {
+    _unused: [u8; 0],
+}
+
+pub const dtor__Buffer_sizeof: usize = 32;
+pub const dtor__Buffer_alignof: usize = 8;
+
+
 
 extern "C" {
 
 pub fn dtor__Struct_Struct(this_: *mut *mut dtor_Struct_t) -> Exception;
 
+/// Like dtor_Struct_Struct, but constructs into this_, which must point to dtor_Struct_sizeof bytes aligned to dtor_Struct_alignof
+pub fn dtor__Struct_Struct_in_place(this_: *mut dtor_Struct_t) -> Exception;
+
 pub fn dtor__Struct_dtor(this_: *mut dtor_Struct_t) -> Exception;
 
+/// Like dtor_Struct_dtor, but leaves the storage at this_ to the caller
+pub fn dtor__Struct_drop_in_place(this_: *mut dtor_Struct_t) -> Exception;
+
+pub fn dtor__Buffer_ctor(this_: *mut *mut dtor_Buffer_t) -> Exception;
+
+/// Like dtor_Buffer_ctor, but constructs into this_, which must point to dtor_Buffer_sizeof bytes aligned to dtor_Buffer_alignof
+pub fn dtor__Buffer_ctor_in_place(this_: *mut dtor_Buffer_t) -> Exception;
+
+pub fn dtor__Buffer_move(this_: *mut *mut dtor_Buffer_t, rhs: *mut dtor_Buffer_t) -> Exception;
+
+/// Like dtor_Buffer_move, but constructs into this_, which must point to dtor_Buffer_sizeof bytes aligned to dtor_Buffer_alignof
+pub fn dtor__Buffer_move_in_place(this_: *mut dtor_Buffer_t, rhs: *mut dtor_Buffer_t) -> Exception;
+
+pub fn dtor__Buffer_move_assign(this_: *mut dtor_Buffer_t, return_: *mut *mut dtor_Buffer_t, rhs: *mut dtor_Buffer_t) -> Exception;
+
+pub fn dtor__Buffer_dtor(this_: *mut dtor_Buffer_t) -> Exception;
+
+/// Like dtor_Buffer_dtor, but leaves the storage at this_ to the caller
+pub fn dtor__Buffer_drop_in_place(this_: *mut dtor_Buffer_t) -> Exception;
+
+pub fn dtor__Buffer_append(this_: *mut dtor_Buffer_t, s: *mut std___cxx11_string_t) -> Exception;
+
+pub fn dtor__Buffer_contents(this_: *const dtor_Buffer_t, return_: *mut *const std___cxx11_string_t) -> Exception;
+
+pub fn dtor__Buffer_split(this_: *mut dtor_Buffer_t, return_: *mut *mut dtor_Buffer_t) -> Exception;
+
+pub fn dtor__Buffer_take(this_: *mut dtor_Buffer_t, return_: *mut *mut dtor_Buffer_t) -> Exception;
+
 
 } // extern "C"
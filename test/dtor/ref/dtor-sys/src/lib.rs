@@ -43,15 +43,38 @@ extern {
 
 pub mod c_dtor;
 pub use c_dtor::dtor__Struct_t as dtor_Struct_t;
+pub use c_dtor::dtor__Struct_sizeof as dtor_Struct_sizeof;
+pub use c_dtor::dtor__Struct_alignof as dtor_Struct_alignof;
+pub use c_dtor::dtor__Buffer_t as dtor_Buffer_t;
+pub use c_dtor::dtor__Buffer_sizeof as dtor_Buffer_sizeof;
+pub use c_dtor::dtor__Buffer_alignof as dtor_Buffer_alignof;
 
 pub use c_dtor::dtor__Struct_Struct as dtor_Struct_Struct;
+pub use c_dtor::dtor__Struct_Struct_in_place as dtor_Struct_Struct_in_place;
 pub use c_dtor::dtor__Struct_dtor as dtor_Struct_dtor;
+pub use c_dtor::dtor__Struct_drop_in_place as dtor_Struct_drop_in_place;
+pub use c_dtor::dtor__Buffer_ctor as dtor_Buffer_ctor;
+pub use c_dtor::dtor__Buffer_ctor_in_place as dtor_Buffer_ctor_in_place;
+pub use c_dtor::dtor__Buffer_move as dtor_Buffer_move;
+pub use c_dtor::dtor__Buffer_move_in_place as dtor_Buffer_move_in_place;
+pub use c_dtor::dtor__Buffer_move_assign as dtor_Buffer_move_assign;
+pub use c_dtor::dtor__Buffer_dtor as dtor_Buffer_dtor;
+pub use c_dtor::dtor__Buffer_drop_in_place as dtor_Buffer_drop_in_place;
+pub use c_dtor::dtor__Buffer_append as dtor_Buffer_append;
+pub use c_dtor::dtor__Buffer_contents as dtor_Buffer_contents;
+pub use c_dtor::dtor__Buffer_split as dtor_Buffer_split;
+pub use c_dtor::dtor__Buffer_take as dtor_Buffer_take;
 pub mod std_string;
 pub use std_string::std____cxx11__basic_string_char__t as std___cxx11_string_t;
+pub use std_string::std____cxx11__basic_string_char__sizeof as std___cxx11_string_sizeof;
+pub use std_string::std____cxx11__basic_string_char__alignof as std___cxx11_string_alignof;
 
 pub use std_string::std____cxx11__basic_string_char__ctor as std___cxx11_string_ctor;
+pub use std_string::std____cxx11__basic_string_char__ctor_in_place as std___cxx11_string_ctor_in_place;
 pub use std_string::std____cxx11__basic_string_char__copy as std___cxx11_string_copy;
+pub use std_string::std____cxx11__basic_string_char__copy_in_place as std___cxx11_string_copy_in_place;
 pub use std_string::std____cxx11__basic_string_char__dtor as std___cxx11_string_dtor;
+pub use std_string::std____cxx11__basic_string_char__drop_in_place as std___cxx11_string_drop_in_place;
 pub use std_string::std____cxx11__basic_string_char__assign as std___cxx11_string_assign;
 pub use std_string::std____cxx11__basic_string_char__c_str as std___cxx11_string_c_str;
 
@@ -10,15 +10,28 @@ pub struct std____cxx11__basic_string_char__t {
     _unused: [u8; 0],
 }
 
+pub const std____cxx11__basic_string_char__sizeof: usize = 32;
+pub const std____cxx11__basic_string_char__alignof: usize = 8;
+
+
 
 extern "C" {
 
 pub fn std____cxx11__basic_string_char__ctor(this_: *mut *mut std___cxx11_string_t) -> Exception;
 
+/// Like std___cxx11_string_ctor, but constructs into this_, which must point to std___cxx11_string_sizeof bytes aligned to std___cxx11_string_alignof
+pub fn std____cxx11__basic_string_char__ctor_in_place(this_: *mut std___cxx11_string_t) -> Exception;
+
 pub fn std____cxx11__basic_string_char__copy(this_: *mut *mut std___cxx11_string_t, rhs: *const std___cxx11_string_t) -> Exception;
 
+/// Like std___cxx11_string_copy, but constructs into this_, which must point to std___cxx11_string_sizeof bytes aligned to std___cxx11_string_alignof
+pub fn std____cxx11__basic_string_char__copy_in_place(this_: *mut std___cxx11_string_t, rhs: *const std___cxx11_string_t) -> Exception;
+
 pub fn std____cxx11__basic_string_char__dtor(this_: *mut std___cxx11_string_t) -> Exception;
 
+/// Like std___cxx11_string_dtor, but leaves the storage at this_ to the caller
+pub fn std____cxx11__basic_string_char__drop_in_place(this_: *mut std___cxx11_string_t) -> Exception;
+
 pub fn std____cxx11__basic_string_char__assign(this_: *mut std___cxx11_string_t, return_: *mut *mut std___cxx11_string_t, s: *const c_char, count: c_ulong) -> Exception;
 
 pub fn std____cxx11__basic_string_char__c_str(this_: *const std___cxx11_string_t, return_: *mut *const c_char) -> Exception;
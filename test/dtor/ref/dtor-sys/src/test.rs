@@ -17,3 +17,85 @@ fn it_works() {
         dtor_Struct_dtor(s.0);
     }
 }
+
+unsafe fn contents(b: *const dtor_Buffer_t) -> String {
+    let mut s = std::ptr::null();
+    dtor_Buffer_contents(b, &mut s);
+    let mut c_str = std::ptr::null();
+    std___cxx11_string_c_str(s, &mut c_str);
+    std::ffi::CStr::from_ptr(c_str).to_str().unwrap().to_string()
+}
+
+#[test]
+fn move_only() {
+    unsafe {
+        let mut b = std::ptr::null_mut();
+        dtor_Buffer_ctor(&mut b);
+
+        // The string is moved into the buffer, so it's still ours to delete
+        let mut s = std::ptr::null_mut();
+        std___cxx11_string_ctor(&mut s);
+        let mut r = std::ptr::null_mut();
+        std___cxx11_string_assign(s, &mut r, b"abc".as_ptr() as _, 3);
+        dtor_Buffer_append(b, s);
+        std___cxx11_string_dtor(s);
+        assert_eq!(contents(b), "abc");
+
+        // Returned by value, and moved into the result
+        let mut split = std::ptr::null_mut();
+        dtor_Buffer_split(b, &mut split);
+        assert_eq!(contents(split), "abc");
+        assert_eq!(contents(b), "");
+
+        // Returned by rvalue reference, and moved into the result
+        let mut taken = std::ptr::null_mut();
+        dtor_Buffer_take(split, &mut taken);
+        assert_eq!(contents(taken), "abc");
+
+        let mut moved = std::ptr::null_mut();
+        dtor_Buffer_move(&mut moved, taken);
+        assert_eq!(contents(moved), "abc");
+
+        let mut assigned = std::ptr::null_mut();
+        dtor_Buffer_move_assign(b, &mut assigned, moved);
+        assert_eq!(assigned, b);
+        assert_eq!(contents(b), "abc");
+
+        for p in [b, split, taken, moved].iter() {
+            dtor_Buffer_dtor(*p);
+        }
+    }
+}
+
+#[test]
+fn in_place() {
+    unsafe {
+        // Caller-owned storage, sized and aligned from the exported constants
+        #[repr(C, align(16))]
+        struct Storage([u8; 64]);
+        assert!(dtor_Buffer_sizeof <= std::mem::size_of::<Storage>());
+        assert!(dtor_Buffer_alignof <= std::mem::align_of::<Storage>());
+
+        let mut a = std::mem::MaybeUninit::<Storage>::uninit();
+        let mut b = std::mem::MaybeUninit::<Storage>::uninit();
+        let a = a.as_mut_ptr() as *mut dtor_Buffer_t;
+        let b = b.as_mut_ptr() as *mut dtor_Buffer_t;
+
+        dtor_Buffer_ctor_in_place(a);
+        assert_eq!(contents(a), "");
+
+        let mut s = std::ptr::null_mut();
+        std___cxx11_string_ctor(&mut s);
+        let mut r = std::ptr::null_mut();
+        std___cxx11_string_assign(s, &mut r, b"xyz".as_ptr() as _, 3);
+        dtor_Buffer_append(a, s);
+        std___cxx11_string_dtor(s);
+
+        dtor_Buffer_move_in_place(b, a);
+        assert_eq!(contents(b), "xyz");
+        assert_eq!(contents(a), "");
+
+        dtor_Buffer_drop_in_place(a);
+        dtor_Buffer_drop_in_place(b);
+    }
+}
@@ -14,7 +14,8 @@ struct Struct {
         CPPMM_THROWS(std::runtime_error, STD_RUNTIME_ERROR);
 } CPPMM_OPAQUEBYTES;
 
-float f1(int a) CPPMM_THROWS(std::invalid_argument, STD_INVALID_ARGUMENT);
+float f1(int a) CPPMM_THROWS(std::invalid_argument, STD_INVALID_ARGUMENT)
+    CPPMM_ASYNC;
 void f2() CPPMM_THROWS(std::invalid_argument, STD_INVALID_ARGUMENT);
 
 } // namespace ex
@@ -1,5 +1,7 @@
 #include <c-ex_private.h>
 
+#include "exceptions-errors-private.h"
+#include "exceptions-task-private.h"
 
 #include <stdexcept>
 
@@ -10,10 +12,10 @@ unsigned int ex__Struct_m1(
         (to_cpp(this_)) -> m1();
         return 0;
     } catch (std::runtime_error& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
         return 1;
     } catch (std::exception& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
         return -1;
     }
 }
@@ -26,13 +28,13 @@ unsigned int ex__Struct_m2(
         *(return_) = (to_cpp(this_)) -> m2(a);
         return 0;
     } catch (std::logic_error& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
         return 2;
     } catch (std::runtime_error& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
         return 1;
     } catch (std::exception& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
         return -1;
     }
 }
@@ -44,10 +46,26 @@ unsigned int ex_f1(
         *(return_) = ex::f1(a);
         return 0;
     } catch (std::invalid_argument& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
         return 3;
     } catch (std::exception& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
+        return -1;
+    }
+}
+unsigned int ex_f1_async(
+    float * return_
+    , int a
+    , exceptions_task_t * * task)
+{
+    try {
+        *(task) = tlg_task_async(ex_f1, return_, a);
+        return 0;
+    } catch (std::invalid_argument& e) {
+        tlg_set_exception_string(e.what());
+        return 3;
+    } catch (std::exception& e) {
+        tlg_set_exception_string(e.what());
         return -1;
     }
 }
@@ -57,10 +75,10 @@ unsigned int ex_f2()
         ex::f2();
         return 0;
     } catch (std::invalid_argument& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
         return 3;
     } catch (std::exception& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
         return -1;
     }
 }
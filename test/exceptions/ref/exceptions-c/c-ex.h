@@ -1,4 +1,6 @@
 #pragma once
+#include "exceptions-export.h"
+#include "exceptions-task.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -11,12 +13,12 @@ typedef ex__Struct_t ex_Struct_t;
 
 
 
-unsigned int ex__Struct_m1(
+EXCEPTIONS_EXPORT unsigned int ex__Struct_m1(
     ex_Struct_t * this_);
 #define ex_Struct_m1 ex__Struct_m1
 
 
-unsigned int ex__Struct_m2(
+EXCEPTIONS_EXPORT unsigned int ex__Struct_m2(
     ex_Struct_t * this_
     , float * return_
     , float a);
@@ -24,19 +26,17 @@ unsigned int ex__Struct_m2(
 
 
 
-
-
-
-
-
-
-
-
-unsigned int ex_f1(
+EXCEPTIONS_EXPORT unsigned int ex_f1(
     float * return_
     , int a);
 
-unsigned int ex_f2();
+/** Start ex_f1 on a worker thread. The result is returned by exceptions_task_result(task) */
+EXCEPTIONS_EXPORT unsigned int ex_f1_async(
+    float * return_
+    , int a
+    , exceptions_task_t * * task);
+
+EXCEPTIONS_EXPORT unsigned int ex_f2();
 #ifdef __cplusplus
 }
 #endif
@@ -1,9 +1,10 @@
 #pragma once
+#include "exceptions-export.h"
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-const char* exceptions_get_exception_string();
+EXCEPTIONS_EXPORT const char* exceptions_get_exception_string();
 
 #ifdef __cplusplus
 }
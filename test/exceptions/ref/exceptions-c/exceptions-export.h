@@ -0,0 +1,5 @@
+#pragma once
+
+#ifndef EXCEPTIONS_EXPORT
+#define EXCEPTIONS_EXPORT __attribute__((visibility("default")))
+#endif
@@ -0,0 +1,13 @@
+#pragma once
+#include "exceptions-task.h"
+#include <functional>
+
+// Queue fn on the worker threads, returning the task to wait on for its result
+exceptions_task_t* tlg_task_submit(std::function<unsigned int()> fn);
+
+// Run f(args...) on the worker threads. The arguments are copied into the
+// task, so whatever they point to must outlive it.
+template <typename F, typename... Args>
+exceptions_task_t* tlg_task_async(F f, Args... args) {
+    return tlg_task_submit([=]() { return f(args...); });
+}
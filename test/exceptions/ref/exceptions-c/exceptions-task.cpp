@@ -0,0 +1,141 @@
+#include "exceptions-task-private.h"
+#include "exceptions-errors-private.h"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#ifndef TLG_TASK_THREADS
+#define TLG_TASK_THREADS 4
+#endif
+
+struct exceptions_task_s {
+    std::function<unsigned int()> fn;
+    std::mutex mutex;
+    std::condition_variable finished;
+    bool done = false;
+    unsigned int result = 0;
+    char exception_string[TLG_EXCEPTION_STRING_SIZE] = {};
+    void (*callback)(void*) = nullptr;
+    void* user_data = nullptr;
+};
+
+namespace {
+
+class tlg_task_pool {
+    std::mutex mutex;
+    std::condition_variable queued;
+    std::deque<exceptions_task_t*> queue;
+    std::vector<std::thread> threads;
+    bool stopping = false;
+
+    void run() {
+        for (;;) {
+            exceptions_task_t* task;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                queued.wait(lock,
+                            [this] { return stopping || !queue.empty(); });
+                if (queue.empty()) {
+                    return;
+                }
+                task = queue.front();
+                queue.pop_front();
+            }
+
+            const unsigned int result = task->fn();
+
+            std::unique_lock<std::mutex> lock(task->mutex);
+            task->fn = nullptr;
+            task->result = result;
+            if (result != 0) {
+                std::strncpy(task->exception_string, TLG_EXCEPTION_STRING,
+                             TLG_EXCEPTION_STRING_SIZE - 1);
+            }
+            auto callback = task->callback;
+            auto user_data = task->user_data;
+            task->done = true;
+            task->finished.notify_all();
+            lock.unlock();
+
+            if (callback) {
+                callback(user_data);
+            }
+        }
+    }
+
+public:
+    ~tlg_task_pool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        queued.notify_all();
+        for (auto& t : threads) {
+            t.join();
+        }
+    }
+
+    void submit(exceptions_task_t* task) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (threads.empty()) {
+                for (int i = 0; i < TLG_TASK_THREADS; ++i) {
+                    threads.emplace_back([this] { run(); });
+                }
+            }
+            queue.push_back(task);
+        }
+        queued.notify_one();
+    }
+};
+
+tlg_task_pool& task_pool() {
+    static tlg_task_pool pool;
+    return pool;
+}
+
+} // namespace
+
+exceptions_task_t* tlg_task_submit(std::function<unsigned int()> fn) {
+    auto* task = new exceptions_task_t;
+    task->fn = std::move(fn);
+    task_pool().submit(task);
+    return task;
+}
+
+int exceptions_task_poll(exceptions_task_t* task) {
+    std::lock_guard<std::mutex> lock(task->mutex);
+    return task->done;
+}
+
+void exceptions_task_wait(exceptions_task_t* task) {
+    std::unique_lock<std::mutex> lock(task->mutex);
+    task->finished.wait(lock, [task] { return task->done; });
+}
+
+unsigned int exceptions_task_result(exceptions_task_t* task) {
+    exceptions_task_wait(task);
+
+    const unsigned int result = task->result;
+    if (result != 0) {
+        tlg_set_exception_string(task->exception_string);
+    }
+    delete task;
+    return result;
+}
+
+void exceptions_task_on_complete(exceptions_task_t* task, void (*callback)(void*),
+                          void* user_data) {
+    {
+        std::lock_guard<std::mutex> lock(task->mutex);
+        if (!task->done) {
+            task->callback = callback;
+            task->user_data = user_data;
+            return;
+        }
+    }
+    callback(user_data);
+}
@@ -0,0 +1,29 @@
+#pragma once
+#include "exceptions-export.h"
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// A call started by one of the _async functions, running on the library's
+/// worker threads. Every task must be finished with exceptions_task_result.
+typedef struct exceptions_task_s exceptions_task_t;
+
+/// Returns 1 if the task has finished and 0 if it's still running
+EXCEPTIONS_EXPORT int exceptions_task_poll(exceptions_task_t* task);
+
+/// Block until the task has finished
+EXCEPTIONS_EXPORT void exceptions_task_wait(exceptions_task_t* task);
+
+/// Wait for the task, free it and return the result of the call. On error the
+/// exception string is set on the calling thread, as for a direct call.
+EXCEPTIONS_EXPORT unsigned int exceptions_task_result(exceptions_task_t* task);
+
+/// Call callback(user_data) once when the task finishes, from the worker
+/// thread, or straight away if it has already finished. Only one callback can
+/// be set per task.
+EXCEPTIONS_EXPORT void exceptions_task_on_complete(exceptions_task_t* task, void (*callback)(void*),
+                              void* user_data);
+
+#ifdef __cplusplus
+}
+#endif
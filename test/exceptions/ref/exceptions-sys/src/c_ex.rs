@@ -27,6 +27,9 @@ pub fn ex__Struct_m2(this_: *mut ex_Struct_t, return_: *mut c_float, a: c_float)
 
 pub fn ex_f1(return_: *mut c_float, a: c_int) -> Exception;
 
+/// Start ex_f1 on a worker thread. The result is returned by exceptions_task_result(task)
+pub fn ex_f1_async(return_: *mut c_float, a: c_int, task: *mut *mut exceptions_task_t) -> Exception;
+
 pub fn ex_f2() -> Exception;
 
 
@@ -61,12 +61,111 @@ extern {
     pub fn exceptions_get_exception_string() -> *const std::os::raw::c_char;
 }
 
+
+/// A call started by one of the _async functions
+#[repr(C)]
+pub struct exceptions_task_t {
+    _unused: [u8; 0],
+}
+
+extern {
+    pub fn exceptions_task_poll(task: *mut exceptions_task_t) -> std::os::raw::c_int;
+    pub fn exceptions_task_wait(task: *mut exceptions_task_t);
+    pub fn exceptions_task_result(task: *mut exceptions_task_t) -> Exception;
+    pub fn exceptions_task_on_complete(
+        task: *mut exceptions_task_t,
+        callback: extern fn(*mut std::os::raw::c_void),
+        user_data: *mut std::os::raw::c_void,
+    );
+}
+
+/// Awaits a task started by one of the _async functions. Dropping the future
+/// blocks until the task has finished.
+pub struct TaskFuture {
+    task: *mut exceptions_task_t,
+    waker: std::sync::Arc<std::sync::Mutex<Option<std::task::Waker>>>,
+    registered: bool,
+}
+
+unsafe impl Send for TaskFuture {}
+
+impl TaskFuture {
+    /// Take ownership of a task returned by an _async function
+    pub unsafe fn new(task: *mut exceptions_task_t) -> TaskFuture {
+        TaskFuture {
+            task,
+            waker: std::sync::Arc::new(std::sync::Mutex::new(None)),
+            registered: false,
+        }
+    }
+
+    /// Block until the task has finished and return its result
+    pub fn wait(mut self) -> Exception {
+        let task = std::mem::replace(&mut self.task, std::ptr::null_mut());
+        unsafe { exceptions_task_result(task) }
+    }
+}
+
+extern fn task_future_wake(user_data: *mut std::os::raw::c_void) {
+    let waker = unsafe {
+        std::sync::Arc::from_raw(
+            user_data as *const std::sync::Mutex<Option<std::task::Waker>>,
+        )
+    };
+    let w = waker.lock().unwrap().take();
+    if let Some(w) = w {
+        w.wake();
+    }
+}
+
+impl std::future::Future for TaskFuture {
+    type Output = Exception;
+
+    fn poll(
+        mut self: std::pin::Pin<&mut Self>,
+        cx: &mut std::task::Context<'_>,
+    ) -> std::task::Poll<Exception> {
+        // The task is freed once its result has been taken
+        if self.task.is_null() {
+            panic!("TaskFuture polled after it completed");
+        }
+
+        *self.waker.lock().unwrap() = Some(cx.waker().clone());
+        if !self.registered {
+            self.registered = true;
+            let user_data = std::sync::Arc::into_raw(self.waker.clone());
+            unsafe {
+                exceptions_task_on_complete(
+                    self.task,
+                    task_future_wake,
+                    user_data as *mut std::os::raw::c_void,
+                );
+            }
+        }
+
+        if unsafe { exceptions_task_poll(self.task) } == 0 {
+            return std::task::Poll::Pending;
+        }
+        let task = std::mem::replace(&mut self.task, std::ptr::null_mut());
+        std::task::Poll::Ready(unsafe { exceptions_task_result(task) })
+    }
+}
+
+impl Drop for TaskFuture {
+    fn drop(&mut self) {
+        if !self.task.is_null() {
+            unsafe { exceptions_task_result(self.task) };
+        }
+    }
+}
+
 pub mod c_ex;
 pub use c_ex::ex__Struct_t as ex_Struct_t;
 
 pub use c_ex::ex__Struct_m1 as ex_Struct_m1;
 pub use c_ex::ex__Struct_m2 as ex_Struct_m2;
 pub use c_ex::ex_f1 as ex_f1;
+pub use c_ex::ex_f1_async as ex_f1_async;
 pub use c_ex::ex_f2 as ex_f2;
 
 
@@ -30,3 +30,79 @@ fn it_works() {
         );
     }
 }
+
+#[test]
+fn async_error() {
+    let mut r = 0.0f32;
+    let mut task = std::ptr::null_mut();
+
+    unsafe {
+        ex_f1_async(&mut r, 1, &mut task).into_result().unwrap();
+        exceptions_task_wait(task);
+        assert_eq!(exceptions_task_poll(task), 1);
+
+        // The exception thrown on the worker thread is reported here
+        assert_eq!(
+            exceptions_task_result(task).into_result(),
+            Err(Error::StdInvalidArgument(String::from(
+                "Your argument is invalid. I win."
+            )))
+        );
+    }
+}
+
+struct ThreadWaker(std::thread::Thread);
+
+impl std::task::Wake for ThreadWaker {
+    fn wake(self: std::sync::Arc<Self>) {
+        self.0.unpark();
+    }
+}
+
+// Poll the future on this thread, parking between polls until it's woken
+fn block_on<F: std::future::Future>(
+    f: &mut std::pin::Pin<&mut F>,
+) -> F::Output {
+    let waker = std::sync::Arc::new(ThreadWaker(std::thread::current())).into();
+    let mut cx = std::task::Context::from_waker(&waker);
+    loop {
+        match f.as_mut().poll(&mut cx) {
+            std::task::Poll::Ready(r) => return r,
+            std::task::Poll::Pending => std::thread::park(),
+        }
+    }
+}
+
+#[test]
+fn task_future() {
+    let mut r = 0.0f32;
+    let mut task = std::ptr::null_mut();
+
+    unsafe {
+        ex_f1_async(&mut r, 1, &mut task).into_result().unwrap();
+        let mut future = TaskFuture::new(task);
+        let mut future = std::pin::Pin::new(&mut future);
+
+        assert_eq!(
+            block_on(&mut future).into_result(),
+            Err(Error::StdInvalidArgument(String::from(
+                "Your argument is invalid. I win."
+            )))
+        );
+    }
+}
+
+#[test]
+#[should_panic(expected = "TaskFuture polled after it completed")]
+fn task_future_polled_after_completion() {
+    let mut r = 0.0f32;
+    let mut task = std::ptr::null_mut();
+
+    unsafe {
+        ex_f1_async(&mut r, 1, &mut task).into_result().unwrap();
+    }
+    let mut future = unsafe { TaskFuture::new(task) };
+    let mut future = std::pin::Pin::new(&mut future);
+    let _ = block_on(&mut future);
+    let _ = block_on(&mut future);
+}
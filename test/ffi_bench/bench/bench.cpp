@@ -0,0 +1,222 @@
+// Each pair of benchmarks makes the same call directly in C++ and through the
+// generated C wrapper, so the difference is the cost of the wrapper itself.
+#include <fbench.hpp>
+
+#include "c-fbench.h"
+
+#include <benchmark/benchmark.h>
+
+namespace {
+
+int callback(void* user_data, int value) {
+    return value + *static_cast<int*>(user_data);
+}
+
+//------------------------------------------------------------------------------
+void add_direct(benchmark::State& state) {
+    int a = 1;
+    for (auto _ : state) {
+        a = fbench::add(a, 1);
+        benchmark::DoNotOptimize(a);
+    }
+}
+BENCHMARK(add_direct);
+
+void add_wrapped(benchmark::State& state) {
+    int a = 1;
+    for (auto _ : state) {
+        fbench_add(&a, a, 1);
+        benchmark::DoNotOptimize(a);
+    }
+}
+BENCHMARK(add_wrapped);
+
+//------------------------------------------------------------------------------
+void add_noexcept_direct(benchmark::State& state) {
+    int a = 1;
+    for (auto _ : state) {
+        a = fbench::add_noexcept(a, 1);
+        benchmark::DoNotOptimize(a);
+    }
+}
+BENCHMARK(add_noexcept_direct);
+
+void add_noexcept_wrapped(benchmark::State& state) {
+    int a = 1;
+    for (auto _ : state) {
+        fbench_add_noexcept(&a, a, 1);
+        benchmark::DoNotOptimize(a);
+    }
+}
+BENCHMARK(add_noexcept_wrapped);
+
+//------------------------------------------------------------------------------
+void scale_direct(benchmark::State& state) {
+    fbench::Vec3 v{1.0f, 2.0f, 3.0f};
+    for (auto _ : state) {
+        v = fbench::scale(v, 1.0f);
+        benchmark::DoNotOptimize(v);
+    }
+}
+BENCHMARK(scale_direct);
+
+void scale_wrapped(benchmark::State& state) {
+    fbench_Vec3_t v{1.0f, 2.0f, 3.0f};
+    for (auto _ : state) {
+        fbench_scale(&v, &v, 1.0f);
+        benchmark::DoNotOptimize(v);
+    }
+}
+BENCHMARK(scale_wrapped);
+
+//------------------------------------------------------------------------------
+void dot_direct(benchmark::State& state) {
+    fbench::Vec3 v{1.0f, 2.0f, 3.0f};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(v);
+        benchmark::DoNotOptimize(fbench::dot(v, v));
+    }
+}
+BENCHMARK(dot_direct);
+
+void dot_wrapped(benchmark::State& state) {
+    fbench_Vec3_t v{1.0f, 2.0f, 3.0f};
+    float result;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(v);
+        fbench_dot(&result, &v, &v);
+        benchmark::DoNotOptimize(result);
+    }
+}
+BENCHMARK(dot_wrapped);
+
+//------------------------------------------------------------------------------
+void opaquebytes_method_direct(benchmark::State& state) {
+    fbench::Counter counter;
+    for (auto _ : state) {
+        counter.increment();
+        benchmark::DoNotOptimize(counter.get());
+    }
+}
+BENCHMARK(opaquebytes_method_direct);
+
+void opaquebytes_method_wrapped(benchmark::State& state) {
+    fbench_Counter_t counter;
+    fbench_Counter_ctor(&counter);
+    int result;
+    for (auto _ : state) {
+        fbench_Counter_increment(&counter);
+        fbench_Counter_get(&counter, &result);
+        benchmark::DoNotOptimize(result);
+    }
+    fbench_Counter_dtor(&counter);
+}
+BENCHMARK(opaquebytes_method_wrapped);
+
+//------------------------------------------------------------------------------
+void opaqueptr_method_direct(benchmark::State& state) {
+    auto* handle = new fbench::Handle();
+    for (auto _ : state) {
+        handle->set(handle->get() + 1);
+        benchmark::DoNotOptimize(handle);
+    }
+    delete handle;
+}
+BENCHMARK(opaqueptr_method_direct);
+
+void opaqueptr_method_wrapped(benchmark::State& state) {
+    fbench_Handle_t* handle;
+    fbench_Handle_ctor(&handle);
+    int result;
+    for (auto _ : state) {
+        fbench_Handle_get(handle, &result);
+        fbench_Handle_set(handle, result + 1);
+        benchmark::DoNotOptimize(handle);
+    }
+    fbench_Handle_dtor(handle);
+}
+BENCHMARK(opaqueptr_method_wrapped);
+
+//------------------------------------------------------------------------------
+void opaqueptr_lifetime_direct(benchmark::State& state) {
+    for (auto _ : state) {
+        auto* handle = new fbench::Handle();
+        benchmark::DoNotOptimize(handle);
+        delete handle;
+    }
+}
+BENCHMARK(opaqueptr_lifetime_direct);
+
+void opaqueptr_lifetime_wrapped(benchmark::State& state) {
+    for (auto _ : state) {
+        fbench_Handle_t* handle;
+        fbench_Handle_ctor(&handle);
+        benchmark::DoNotOptimize(handle);
+        fbench_Handle_dtor(handle);
+    }
+}
+BENCHMARK(opaqueptr_lifetime_wrapped);
+
+//------------------------------------------------------------------------------
+void checked_direct(benchmark::State& state) {
+    int a = 1;
+    for (auto _ : state) {
+        a = fbench::checked(a);
+        benchmark::DoNotOptimize(a);
+    }
+}
+BENCHMARK(checked_direct);
+
+void checked_wrapped(benchmark::State& state) {
+    int a = 1;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(fbench_checked(&a, a));
+    }
+}
+BENCHMARK(checked_wrapped);
+
+void checked_throw_direct(benchmark::State& state) {
+    int a = 0;
+    for (auto _ : state) {
+        try {
+            a = fbench::checked(-1);
+        } catch (std::invalid_argument& e) {
+            benchmark::DoNotOptimize(e.what());
+        }
+    }
+    benchmark::DoNotOptimize(a);
+}
+BENCHMARK(checked_throw_direct);
+
+void checked_throw_wrapped(benchmark::State& state) {
+    int a = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(fbench_checked(&a, -1));
+    }
+}
+BENCHMARK(checked_throw_wrapped);
+
+//------------------------------------------------------------------------------
+void callback_direct(benchmark::State& state) {
+    int user_data = 1;
+    int a = 0;
+    for (auto _ : state) {
+        a = fbench::call(callback, &user_data, a);
+        benchmark::DoNotOptimize(a);
+    }
+}
+BENCHMARK(callback_direct);
+
+void callback_wrapped(benchmark::State& state) {
+    int user_data = 1;
+    int a = 0;
+    for (auto _ : state) {
+        fbench_call(&a, callback, &user_data, a);
+        benchmark::DoNotOptimize(a);
+    }
+}
+BENCHMARK(callback_wrapped);
+
+} // namespace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,164 @@
+// Each group compares a native Rust baseline with the generated binding, both
+// ignoring the returned Exception and checking it with into_result(), so the
+// difference is the cost of crossing the boundary and of the error check.
+use criterion::{black_box, criterion_group, criterion_main, Criterion};
+use fbench_sys::*;
+use std::os::raw::{c_int, c_void};
+
+#[inline(never)]
+fn native_add(a: i32, b: i32) -> i32 {
+    a + b
+}
+
+extern "C" fn callback(user_data: *mut c_void, value: c_int) -> c_int {
+    value + unsafe { *(user_data as *mut c_int) }
+}
+
+fn vec3() -> fbench_Vec3_t {
+    fbench_Vec3_t {
+        x: 1.0,
+        y: 2.0,
+        z: 3.0,
+    }
+}
+
+fn builtin_args(c: &mut Criterion) {
+    let mut group = c.benchmark_group("add");
+    group.bench_function("native", |b| {
+        b.iter(|| native_add(black_box(1), black_box(2)))
+    });
+    group.bench_function("sys", |b| {
+        b.iter(|| unsafe {
+            let mut r = 0;
+            fbench_add(&mut r, black_box(1), black_box(2));
+            r
+        })
+    });
+    group.bench_function("sys_into_result", |b| {
+        b.iter(|| unsafe {
+            let mut r = 0;
+            fbench_add(&mut r, black_box(1), black_box(2))
+                .into_result()
+                .unwrap();
+            r
+        })
+    });
+    group.bench_function("sys_noexcept", |b| {
+        b.iter(|| unsafe {
+            let mut r = 0;
+            fbench_add_noexcept(&mut r, black_box(1), black_box(2));
+            r
+        })
+    });
+    group.finish();
+}
+
+fn value_types(c: &mut Criterion) {
+    let mut group = c.benchmark_group("value_type");
+    let v = vec3();
+    group.bench_function("scale", |b| {
+        b.iter(|| unsafe {
+            let mut r = vec3();
+            fbench_scale(&mut r, &v, black_box(2.0));
+            r
+        })
+    });
+    group.bench_function("dot", |b| {
+        b.iter(|| unsafe {
+            let mut r = 0.0;
+            fbench_dot(&mut r, &v, black_box(&v));
+            r
+        })
+    });
+    group.finish();
+}
+
+fn records(c: &mut Criterion) {
+    let mut group = c.benchmark_group("record");
+    unsafe {
+        let mut counter = fbench_Counter_t::default();
+        fbench_Counter_ctor(&mut counter);
+        group.bench_function("opaquebytes_method", |b| {
+            b.iter(|| {
+                let mut r = 0;
+                fbench_Counter_increment(&mut counter);
+                fbench_Counter_get(&counter, &mut r);
+                r
+            })
+        });
+        fbench_Counter_dtor(&mut counter);
+
+        let mut handle = std::ptr::null_mut();
+        fbench_Handle_ctor(&mut handle);
+        group.bench_function("opaqueptr_method", |b| {
+            b.iter(|| {
+                let mut r = 0;
+                fbench_Handle_get(handle, &mut r);
+                fbench_Handle_set(handle, r + 1);
+                r
+            })
+        });
+        fbench_Handle_dtor(handle);
+
+        group.bench_function("opaqueptr_lifetime", |b| {
+            b.iter(|| {
+                let mut handle = std::ptr::null_mut();
+                fbench_Handle_ctor(&mut handle);
+                fbench_Handle_dtor(black_box(handle));
+            })
+        });
+    }
+    group.finish();
+}
+
+fn exceptions(c: &mut Criterion) {
+    let mut group = c.benchmark_group("checked");
+    group.bench_function("ok", |b| {
+        b.iter(|| unsafe {
+            let mut r = 0;
+            fbench_checked(&mut r, black_box(1)).into_result().unwrap();
+            r
+        })
+    });
+    group.bench_function("throw", |b| {
+        b.iter(|| unsafe {
+            let mut r = 0;
+            fbench_checked(&mut r, black_box(-1)).into_result().is_err()
+        })
+    });
+    group.finish();
+}
+
+fn callbacks(c: &mut Criterion) {
+    let mut group = c.benchmark_group("callback");
+    let mut user_data: c_int = 1;
+    let user_data = &mut user_data as *mut c_int as *mut c_void;
+    group.bench_function("extern_fn", |b| {
+        b.iter(|| unsafe {
+            let mut r = 0;
+            fbench_call(&mut r, callback, user_data, black_box(1));
+            r
+        })
+    });
+    let offset = 1;
+    let mut add_offset = |value: c_int| value + offset;
+    let (cb, data) = fbench_Callback_closure(&mut add_offset);
+    group.bench_function("closure", |b| {
+        b.iter(|| unsafe {
+            let mut r = 0;
+            fbench_call(&mut r, cb, data, black_box(1));
+            r
+        })
+    });
+    group.finish();
+}
+
+criterion_group!(
+    benches,
+    builtin_args,
+    value_types,
+    records,
+    exceptions,
+    callbacks
+);
+criterion_main!(benches);
@@ -0,0 +1,46 @@
+#include <fbench.hpp>
+
+#include <cppmm_bind.hpp>
+
+namespace cppmm_bind {
+
+namespace fbench {
+
+struct Vec3 {
+    using BoundType = ::fbench::Vec3;
+} CPPMM_VALUETYPE CPPMM_TRIVIALLY_COPYABLE CPPMM_TRIVIALLY_MOVABLE;
+
+class Counter {
+public:
+    using BoundType = ::fbench::Counter;
+
+    Counter() CPPMM_RENAME(ctor);
+    ~Counter();
+
+    int get() const;
+    void increment();
+} CPPMM_OPAQUEBYTES;
+
+class Handle {
+public:
+    using BoundType = ::fbench::Handle;
+
+    Handle() CPPMM_RENAME(ctor);
+    ~Handle();
+
+    int get() const;
+    void set(int value);
+} CPPMM_OPAQUEPTR;
+
+using Callback = ::fbench::Callback;
+
+int add(int a, int b);
+int add_noexcept(int a, int b) noexcept;
+::fbench::Vec3 scale(const ::fbench::Vec3& v, float s);
+float dot(const ::fbench::Vec3& a, const ::fbench::Vec3& b);
+int checked(int a) CPPMM_THROWS(std::invalid_argument, INVALID_ARGUMENT);
+int call(::fbench::Callback cb, void* user_data, int value);
+
+} // namespace fbench
+
+} // namespace cppmm_bind
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <stdexcept>
+
+// Everything is kept out of line so that the direct calls the wrappers are
+// measured against pay for a real call too
+#define FBENCH_NOINLINE __attribute__((noinline))
+
+namespace fbench {
+
+struct Vec3 {
+    float x;
+    float y;
+    float z;
+};
+
+class Counter {
+    int _count = 0;
+
+public:
+    FBENCH_NOINLINE Counter() {}
+    // Defaulted so that Counter stays trivially copyable and can be bound by
+    // value
+    ~Counter() = default;
+
+    FBENCH_NOINLINE int get() const { return _count; }
+    FBENCH_NOINLINE void increment() { ++_count; }
+};
+
+class Handle {
+    int _value = 0;
+
+public:
+    FBENCH_NOINLINE Handle() {}
+    FBENCH_NOINLINE ~Handle() {}
+
+    FBENCH_NOINLINE int get() const { return _value; }
+    FBENCH_NOINLINE void set(int value) { _value = value; }
+};
+
+typedef int (*Callback)(void* user_data, int value);
+
+FBENCH_NOINLINE inline int add(int a, int b) { return a + b; }
+
+FBENCH_NOINLINE inline int add_noexcept(int a, int b) noexcept {
+    return a + b;
+}
+
+FBENCH_NOINLINE inline Vec3 scale(const Vec3& v, float s) {
+    return Vec3{v.x * s, v.y * s, v.z * s};
+}
+
+FBENCH_NOINLINE inline float dot(const Vec3& a, const Vec3& b) {
+    return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+
+FBENCH_NOINLINE inline int checked(int a) {
+    if (a < 0) {
+        throw std::invalid_argument("a must not be negative");
+    }
+    return a;
+}
+
+FBENCH_NOINLINE inline int call(Callback cb, void* user_data, int value) {
+    return cb(user_data, value);
+}
+
+} // namespace fbench
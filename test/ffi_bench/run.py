@@ -0,0 +1,117 @@
+"""Measure the call overhead of the generated fbench bindings
+
+Generates the bindings, then runs the Google Benchmark suite in bench/ against
+the C library and the Criterion suite in benches/ against the -sys crate. The
+mean time of every benchmark is appended, with the current commit, as one line
+of JSON to the results file so that runs can be compared across commits.
+"""
+import argparse
+import datetime
+import glob
+import json
+import os
+import shutil
+import subprocess
+import sys
+
+SOURCE_DIR = os.path.dirname(os.path.abspath(__file__))
+PROJECT = 'fbench'
+
+
+def run(args, cwd=None):
+    print('Running ' + ' '.join(args))
+    result = subprocess.run(args, cwd=cwd)
+    if result.returncode != 0:
+        print('{} exited with non-zero return code {}'.format(
+            args[0], result.returncode))
+        sys.exit(result.returncode)
+
+
+def generate(astgen, asttoc, output_dir):
+    ast_dir = os.path.join(output_dir, 'ast')
+    run([astgen, os.path.join(SOURCE_DIR, 'bind'), '-o', ast_dir, '--',
+         '-I' + os.path.join(SOURCE_DIR, 'include')])
+    run([asttoc, ast_dir, '-o', output_dir, '-p', PROJECT])
+
+
+def bench_c(output_dir):
+    """Run the Google Benchmark suite, returning ns per call by name"""
+    build_dir = os.path.join(output_dir, 'bench-build')
+    run(['cmake', '-S', os.path.join(SOURCE_DIR, 'bench'), '-B', build_dir,
+         '-DFBENCH_C_DIR=' + os.path.join(output_dir, PROJECT + '-c')])
+    run(['cmake', '--build', build_dir])
+
+    report = os.path.join(output_dir, 'c.json')
+    run([os.path.join(build_dir, 'fbench-bench'),
+         '--benchmark_out=' + report, '--benchmark_out_format=json'])
+
+    with open(report) as f:
+        benchmarks = json.load(f)['benchmarks']
+
+    scale = {'ns': 1.0, 'us': 1e3, 'ms': 1e6, 's': 1e9}
+    return {b['name']: b['real_time'] * scale[b['time_unit']]
+            for b in benchmarks}
+
+
+def bench_rust(output_dir):
+    """Run the Criterion suite, returning ns per call by group/name"""
+    crate_dir = os.path.join(output_dir, PROJECT + '-sys')
+    benches_dir = os.path.join(crate_dir, 'benches')
+    os.makedirs(benches_dir, exist_ok=True)
+    shutil.copyfile(os.path.join(SOURCE_DIR, 'benches', 'ffi.rs'),
+                    os.path.join(benches_dir, 'ffi.rs'))
+
+    with open(os.path.join(crate_dir, 'Cargo.toml'), 'a') as f:
+        f.write('\n[dev-dependencies]\ncriterion = "0.3"\n\n'
+                '[[bench]]\nname = "ffi"\nharness = false\n')
+
+    run(['cargo', 'bench', '--bench', 'ffi', '--', '--noplot'], cwd=crate_dir)
+
+    criterion_dir = os.path.join(crate_dir, 'target', 'criterion')
+    results = {}
+    for estimates in glob.glob(os.path.join(criterion_dir, '*', '*', 'new',
+                                            'estimates.json')):
+        bench_dir = os.path.dirname(os.path.dirname(estimates))
+        name = os.path.relpath(bench_dir, criterion_dir).replace(os.sep, '/')
+        with open(estimates) as f:
+            results[name] = json.load(f)['mean']['point_estimate']
+    return results
+
+
+def commit():
+    result = subprocess.run(['git', 'rev-parse', 'HEAD'], cwd=SOURCE_DIR,
+                            stdout=subprocess.PIPE, universal_newlines=True)
+    return result.stdout.strip() if result.returncode == 0 else None
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('astgen')
+    parser.add_argument('asttoc')
+    parser.add_argument('output_dir')
+    parser.add_argument('--results', help='file to append the results to. '
+                        'Defaults to <output_dir>/results.jsonl')
+    parser.add_argument('--no-rust', action='store_true',
+                        help="don't run the Criterion benchmarks")
+    args = parser.parse_args()
+
+    # Everything but the results is regenerated on each run
+    output_dir = os.path.abspath(args.output_dir)
+    work_dir = os.path.join(output_dir, 'work')
+    shutil.rmtree(work_dir, ignore_errors=True)
+    os.makedirs(work_dir)
+
+    generate(args.astgen, args.asttoc, work_dir)
+
+    record = {
+        'commit': commit(),
+        'date': datetime.datetime.now().isoformat(timespec='seconds'),
+        'c': bench_c(work_dir),
+    }
+    if not args.no_rust:
+        record['rust'] = bench_rust(work_dir)
+
+    results = args.results or os.path.join(output_dir, 'results.jsonl')
+    with open(results, 'a') as f:
+        f.write(json.dumps(record, sort_keys=True) + '\n')
+    print('Appended results to ' + results)
@@ -1,5 +1,7 @@
 #include <c-fptr_private.h>
 
+#include "function_pointers-errors-private.h"
+#include <fptr.hpp>
 
 #include <stdexcept>
 
@@ -11,7 +13,7 @@ unsigned int fptr_takes_ages(
         fptr::takes_ages(cb, data);
         return 0;
     } catch (std::exception& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
         return -1;
     }
 }
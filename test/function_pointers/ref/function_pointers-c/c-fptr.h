@@ -1,4 +1,5 @@
 #pragma once
+#include "function_pointers-export.h"
 #include <stdbool.h>
 
 #ifdef __cplusplus
@@ -7,7 +8,7 @@ extern "C" {
 
 typedef _Bool  (*fptr_ProgressCallback_t)(void * , float );
 
-unsigned int fptr_takes_ages(
+FUNCTION_POINTERS_EXPORT unsigned int fptr_takes_ages(
     fptr_ProgressCallback_t cb
     , void * data);
 #ifdef __cplusplus
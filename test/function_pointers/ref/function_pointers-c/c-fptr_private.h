@@ -2,9 +2,14 @@
 #include <c-fptr.h>
 
 
-#include "function_pointers-errors-private.h"
 
-#include <cstring>
-#include <fptr.hpp>
+struct fptr_ProgressCallback_fn {
+    fptr_ProgressCallback_t fn;
+    void * user_data;
+
+    _Bool operator()(float a1) const {
+        return fn(user_data, a1);
+    }
+};
 
 
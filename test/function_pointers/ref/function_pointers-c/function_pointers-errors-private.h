@@ -1,3 +1,23 @@
 #pragma once
-#include <string>
-extern thread_local std::string TLG_EXCEPTION_STRING;
+#include <cstddef>
+#include <cstring>
+
+#ifndef TLG_EXCEPTION_STRING_SIZE
+#define TLG_EXCEPTION_STRING_SIZE 256
+#endif
+
+extern thread_local char TLG_EXCEPTION_STRING[TLG_EXCEPTION_STRING_SIZE]
+    __attribute__((tls_model("initial-exec")));
+
+inline void tlg_set_exception_string(const char* what) {
+    size_t len = std::strlen(what);
+    if (len >= TLG_EXCEPTION_STRING_SIZE) {
+        len = TLG_EXCEPTION_STRING_SIZE - 1;
+        // Don't cut a UTF-8 sequence in half
+        while (len > 0 && (what[len] & 0xC0) == 0x80) {
+            --len;
+        }
+    }
+    std::memcpy(TLG_EXCEPTION_STRING, what, len);
+    TLG_EXCEPTION_STRING[len] = '\0';
+}
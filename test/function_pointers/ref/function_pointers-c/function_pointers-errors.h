@@ -1,9 +1,10 @@
 #pragma once
+#include "function_pointers-export.h"
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-const char* function_pointers_get_exception_string();
+FUNCTION_POINTERS_EXPORT const char* function_pointers_get_exception_string();
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,5 @@
+#pragma once
+
+#ifndef FUNCTION_POINTERS_EXPORT
+#define FUNCTION_POINTERS_EXPORT __attribute__((visibility("default")))
+#endif
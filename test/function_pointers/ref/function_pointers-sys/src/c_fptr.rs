@@ -7,6 +7,15 @@ use std::os::raw::*;
 
 
 
+/// Turn a closure into a fptr_ProgressCallback_t and the user data to pass with it, without
+/// boxing. The closure must outlive every call made through them.
+pub fn fptr_ProgressCallback_closure<F: FnMut(c_float) -> bool>(f: &mut F) -> (extern fn(*mut c_void, c_float) -> bool, *mut c_void) {
+    extern fn trampoline<F: FnMut(c_float) -> bool>(a0: *mut c_void, a1: c_float) -> bool {
+        unsafe { (*(a0 as *mut F))(a1) }
+    }
+    (trampoline::<F>, f as *mut F as *mut c_void)
+}
+
 extern "C" {
 
 pub fn fptr_takes_ages(cb: extern fn(*mut c_void, c_float) -> bool, data: *mut c_void) -> Exception;
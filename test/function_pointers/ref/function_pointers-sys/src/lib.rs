@@ -43,6 +43,7 @@ extern {
 
 pub mod c_fptr;
 
+pub use c_fptr::fptr_ProgressCallback_closure;
 pub use c_fptr::fptr_takes_ages as fptr_takes_ages;
 
 
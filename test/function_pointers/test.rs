@@ -26,3 +26,17 @@ fn it_works() {
         [0.0f32, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0]
     );
 }
+
+#[test]
+fn closure() {
+    let mut pc = Vec::new();
+    let mut record = |p: f32| {
+        pc.push(p);
+        true
+    };
+    let (cb, data) = fptr_ProgressCallback_closure(&mut record);
+    unsafe {
+        fptr_takes_ages(cb, data);
+    }
+    assert_eq!(pc, [0.0f32, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0]);
+}
@@ -23,7 +23,7 @@ public:
     bool equalWithRelError(const Vec3<T>& v, T e) const;
     */
 
-    T dot(const ::Imath::Vec3<T>& v) const;
+    T dot(const ::Imath::Vec3<T>& v) const CPPMM_BATCH;
     ::Imath::Vec3<T> cross(const ::Imath::Vec3<T>& v) const;
     const ::Imath::Vec3<T>& operator+=(const ::Imath::Vec3<T>& v)
         CPPMM_RENAME(op_iadd);
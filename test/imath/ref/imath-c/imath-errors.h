@@ -1,9 +1,10 @@
 #pragma once
+#include "imath-export.h"
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-const char* imath_get_exception_string();
+IMATH_EXPORT const char* imath_get_exception_string();
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,5 @@
+#pragma once
+
+#ifndef IMATH_EXPORT
+#define IMATH_EXPORT __attribute__((visibility("default")))
+#endif
@@ -1,5 +1,6 @@
 #include <imath_box_private.h>
 
+#include "imath-errors-private.h"
 #include <imath_vec_private.h>
 
 #include <stdexcept>
@@ -12,7 +13,7 @@ unsigned int Imath_2_5__Box_Imath__Vec3_float___extendBy(
         (to_cpp(this_)) -> extendBy(to_cpp_ref(point));
         return 0;
     } catch (std::exception& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
         return -1;
     }
 }
@@ -24,7 +25,7 @@ unsigned int Imath_2_5__Box_Imath__Vec3_float___extendBy_1(
         (to_cpp(this_)) -> extendBy(to_cpp_ref(box));
         return 0;
     } catch (std::exception& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
         return -1;
     }
 }
@@ -36,7 +37,7 @@ unsigned int Imath_2_5__Box_Imath__Vec3_int___extendBy(
         (to_cpp(this_)) -> extendBy(to_cpp_ref(point));
         return 0;
     } catch (std::exception& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
         return -1;
     }
 }
@@ -48,7 +49,7 @@ unsigned int Imath_2_5__Box_Imath__Vec3_int___extendBy_1(
         (to_cpp(this_)) -> extendBy(to_cpp_ref(box));
         return 0;
     } catch (std::exception& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
         return -1;
     }
 }
@@ -1,5 +1,6 @@
 #include <imath_vec_private.h>
 
+#include "imath-errors-private.h"
 #include <new>
 
 #include <stdexcept>
@@ -11,7 +12,7 @@ unsigned int Imath_2_5__Vec3_float__Vec3(
         new (this_) Imath_2_5::Vec3<float>();
         return 0;
     } catch (std::exception& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
         return -1;
     }
 }
@@ -23,7 +24,7 @@ unsigned int Imath_2_5__Vec3_float__Vec3_1(
         new (this_) Imath_2_5::Vec3<float>(to_cpp_ref(rhs));
         return 0;
     } catch (std::exception& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
         return -1;
     }
 }
@@ -37,7 +38,7 @@ unsigned int Imath_2_5__Vec3_float__setValue(
         (to_cpp(this_)) -> setValue<float>(a, b, c);
         return 0;
     } catch (std::exception& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
         return -1;
     }
 }
@@ -50,7 +51,23 @@ unsigned int Imath_2_5__Vec3_float__dot(
         *(return_) = (to_cpp(this_)) -> dot(to_cpp_ref(v));
         return 0;
     } catch (std::exception& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
+        return -1;
+    }
+}
+unsigned int Imath_2_5__Vec3_float__dot_batch(
+    Imath_V3f_t const * this_
+    , Imath_V3f_t const * v
+    , size_t n
+    , float * out)
+{
+    try {
+        for (size_t i = 0; i < n; ++i) {
+            *((out + i)) = (to_cpp((this_ + i))) -> dot(to_cpp_ref((v + i)));
+        }
+        return 0;
+    } catch (std::exception& e) {
+        tlg_set_exception_string(e.what());
         return -1;
     }
 }
@@ -63,7 +80,7 @@ unsigned int Imath_2_5__Vec3_float__cross(
         to_c_copy(return_, (to_cpp(this_)) -> cross(to_cpp_ref(v)));
         return 0;
     } catch (std::exception& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
         return -1;
     }
 }
@@ -76,7 +93,7 @@ unsigned int Imath_2_5__Vec3_float__op_iadd(
         to_c(return_, (to_cpp(this_)) -> operator+=(to_cpp_ref(v)));
         return 0;
     } catch (std::exception& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
         return -1;
     }
 }
@@ -88,7 +105,7 @@ unsigned int Imath_2_5__Vec3_float__length(
         *(return_) = (to_cpp(this_)) -> length();
         return 0;
     } catch (std::exception& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
         return -1;
     }
 }
@@ -100,7 +117,7 @@ unsigned int Imath_2_5__Vec3_float__length2(
         *(return_) = (to_cpp(this_)) -> length2();
         return 0;
     } catch (std::exception& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
         return -1;
     }
 }
@@ -112,7 +129,7 @@ unsigned int Imath_2_5__Vec3_float__normalize(
         to_c(return_, (to_cpp(this_)) -> normalize());
         return 0;
     } catch (std::exception& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
         return -1;
     }
 }
@@ -124,7 +141,7 @@ unsigned int Imath_2_5__Vec3_float__normalized(
         to_c_copy(return_, (to_cpp(this_)) -> normalized());
         return 0;
     } catch (std::exception& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
         return -1;
     }
 }
@@ -135,7 +152,7 @@ unsigned int Imath_2_5__Vec3_int__Vec3(
         new (this_) Imath_2_5::Vec3<int>();
         return 0;
     } catch (std::exception& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
         return -1;
     }
 }
@@ -147,7 +164,7 @@ unsigned int Imath_2_5__Vec3_int__Vec3_1(
         new (this_) Imath_2_5::Vec3<int>(to_cpp_ref(rhs));
         return 0;
     } catch (std::exception& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
         return -1;
     }
 }
@@ -160,7 +177,23 @@ unsigned int Imath_2_5__Vec3_int__dot(
         *(return_) = (to_cpp(this_)) -> dot(to_cpp_ref(v));
         return 0;
     } catch (std::exception& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
+        return -1;
+    }
+}
+unsigned int Imath_2_5__Vec3_int__dot_batch(
+    Imath_V3i_t const * this_
+    , Imath_V3i_t const * v
+    , size_t n
+    , int * out)
+{
+    try {
+        for (size_t i = 0; i < n; ++i) {
+            *((out + i)) = (to_cpp((this_ + i))) -> dot(to_cpp_ref((v + i)));
+        }
+        return 0;
+    } catch (std::exception& e) {
+        tlg_set_exception_string(e.what());
         return -1;
     }
 }
@@ -173,7 +206,7 @@ unsigned int Imath_2_5__Vec3_int__cross(
         to_c_copy(return_, (to_cpp(this_)) -> cross(to_cpp_ref(v)));
         return 0;
     } catch (std::exception& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
         return -1;
     }
 }
@@ -186,7 +219,7 @@ unsigned int Imath_2_5__Vec3_int__op_iadd(
         to_c(return_, (to_cpp(this_)) -> operator+=(to_cpp_ref(v)));
         return 0;
     } catch (std::exception& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
         return -1;
     }
 }
@@ -198,7 +231,7 @@ unsigned int Imath_2_5__Vec3_int__length(
         *(return_) = (to_cpp(this_)) -> length();
         return 0;
     } catch (std::exception& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
         return -1;
     }
 }
@@ -210,7 +243,7 @@ unsigned int Imath_2_5__Vec3_int__length2(
         *(return_) = (to_cpp(this_)) -> length2();
         return 0;
     } catch (std::exception& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
         return -1;
     }
 }
@@ -222,7 +255,7 @@ unsigned int Imath_2_5__Vec3_int__normalize(
         to_c(return_, (to_cpp(this_)) -> normalize());
         return 0;
     } catch (std::exception& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
         return -1;
     }
 }
@@ -234,7 +267,7 @@ unsigned int Imath_2_5__Vec3_int__normalized(
         to_c_copy(return_, (to_cpp(this_)) -> normalized());
         return 0;
     } catch (std::exception& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
         return -1;
     }
 }
@@ -1,4 +1,6 @@
 #pragma once
+#include "imath-export.h"
+#include <stddef.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -20,18 +22,18 @@ typedef Imath_2_5__Vec3_int__t Imath_V3i_t;
 
 
 
-unsigned int Imath_2_5__Vec3_float__Vec3(
+IMATH_EXPORT unsigned int Imath_2_5__Vec3_float__Vec3(
     Imath_V3f_t * this_);
 #define Imath_V3f_Vec3 Imath_2_5__Vec3_float__Vec3
 
 
-unsigned int Imath_2_5__Vec3_float__Vec3_1(
+IMATH_EXPORT unsigned int Imath_2_5__Vec3_float__Vec3_1(
     Imath_V3f_t * this_
     , Imath_V3f_t const * rhs);
 #define Imath_V3f_Vec3_1 Imath_2_5__Vec3_float__Vec3_1
 
 
-unsigned int Imath_2_5__Vec3_float__setValue(
+IMATH_EXPORT unsigned int Imath_2_5__Vec3_float__setValue(
     Imath_V3f_t * this_
     , float a
     , float b
@@ -39,124 +41,126 @@ unsigned int Imath_2_5__Vec3_float__setValue(
 #define Imath_V3f_setValue Imath_2_5__Vec3_float__setValue
 
 
-unsigned int Imath_2_5__Vec3_float__dot(
+IMATH_EXPORT unsigned int Imath_2_5__Vec3_float__dot(
     Imath_V3f_t const * this_
     , float * return_
     , Imath_V3f_t const * v);
 #define Imath_V3f_dot Imath_2_5__Vec3_float__dot
 
 
-unsigned int Imath_2_5__Vec3_float__cross(
+/** Call dot on each of the n records at this_ */
+IMATH_EXPORT unsigned int Imath_2_5__Vec3_float__dot_batch(
+    Imath_V3f_t const * this_
+    , Imath_V3f_t const * v
+    , size_t n
+    , float * out);
+#define Imath_V3f_dot_batch Imath_2_5__Vec3_float__dot_batch
+
+
+IMATH_EXPORT unsigned int Imath_2_5__Vec3_float__cross(
     Imath_V3f_t const * this_
     , Imath_V3f_t * return_
     , Imath_V3f_t const * v);
 #define Imath_V3f_cross Imath_2_5__Vec3_float__cross
 
 
-unsigned int Imath_2_5__Vec3_float__op_iadd(
+IMATH_EXPORT unsigned int Imath_2_5__Vec3_float__op_iadd(
     Imath_V3f_t * this_
     , Imath_V3f_t const * * return_
     , Imath_V3f_t const * v);
 #define Imath_V3f_op_iadd Imath_2_5__Vec3_float__op_iadd
 
 
-unsigned int Imath_2_5__Vec3_float__length(
+IMATH_EXPORT unsigned int Imath_2_5__Vec3_float__length(
     Imath_V3f_t const * this_
     , float * return_);
 #define Imath_V3f_length Imath_2_5__Vec3_float__length
 
 
-unsigned int Imath_2_5__Vec3_float__length2(
+IMATH_EXPORT unsigned int Imath_2_5__Vec3_float__length2(
     Imath_V3f_t const * this_
     , float * return_);
 #define Imath_V3f_length2 Imath_2_5__Vec3_float__length2
 
 
-unsigned int Imath_2_5__Vec3_float__normalize(
+IMATH_EXPORT unsigned int Imath_2_5__Vec3_float__normalize(
     Imath_V3f_t * this_
     , Imath_V3f_t const * * return_);
 #define Imath_V3f_normalize Imath_2_5__Vec3_float__normalize
 
 
-unsigned int Imath_2_5__Vec3_float__normalized(
+IMATH_EXPORT unsigned int Imath_2_5__Vec3_float__normalized(
     Imath_V3f_t const * this_
     , Imath_V3f_t * return_);
 #define Imath_V3f_normalized Imath_2_5__Vec3_float__normalized
 
 
 
-
-
-
-
-
-
-
-
-unsigned int Imath_2_5__Vec3_int__Vec3(
+IMATH_EXPORT unsigned int Imath_2_5__Vec3_int__Vec3(
     Imath_V3i_t * this_);
 #define Imath_V3i_Vec3 Imath_2_5__Vec3_int__Vec3
 
 
-unsigned int Imath_2_5__Vec3_int__Vec3_1(
+IMATH_EXPORT unsigned int Imath_2_5__Vec3_int__Vec3_1(
     Imath_V3i_t * this_
     , Imath_V3i_t const * rhs);
 #define Imath_V3i_Vec3_1 Imath_2_5__Vec3_int__Vec3_1
 
 
-unsigned int Imath_2_5__Vec3_int__dot(
+IMATH_EXPORT unsigned int Imath_2_5__Vec3_int__dot(
     Imath_V3i_t const * this_
     , int * return_
     , Imath_V3i_t const * v);
 #define Imath_V3i_dot Imath_2_5__Vec3_int__dot
 
 
-unsigned int Imath_2_5__Vec3_int__cross(
+/** Call dot on each of the n records at this_ */
+IMATH_EXPORT unsigned int Imath_2_5__Vec3_int__dot_batch(
+    Imath_V3i_t const * this_
+    , Imath_V3i_t const * v
+    , size_t n
+    , int * out);
+#define Imath_V3i_dot_batch Imath_2_5__Vec3_int__dot_batch
+
+
+IMATH_EXPORT unsigned int Imath_2_5__Vec3_int__cross(
     Imath_V3i_t const * this_
     , Imath_V3i_t * return_
     , Imath_V3i_t const * v);
 #define Imath_V3i_cross Imath_2_5__Vec3_int__cross
 
 
-unsigned int Imath_2_5__Vec3_int__op_iadd(
+IMATH_EXPORT unsigned int Imath_2_5__Vec3_int__op_iadd(
     Imath_V3i_t * this_
     , Imath_V3i_t const * * return_
     , Imath_V3i_t const * v);
 #define Imath_V3i_op_iadd Imath_2_5__Vec3_int__op_iadd
 
 
-unsigned int Imath_2_5__Vec3_int__length(
+IMATH_EXPORT unsigned int Imath_2_5__Vec3_int__length(
     Imath_V3i_t const * this_
     , int * return_);
 #define Imath_V3i_length Imath_2_5__Vec3_int__length
 
 
-unsigned int Imath_2_5__Vec3_int__length2(
+IMATH_EXPORT unsigned int Imath_2_5__Vec3_int__length2(
     Imath_V3i_t const * this_
     , int * return_);
 #define Imath_V3i_length2 Imath_2_5__Vec3_int__length2
 
 
-unsigned int Imath_2_5__Vec3_int__normalize(
+IMATH_EXPORT unsigned int Imath_2_5__Vec3_int__normalize(
     Imath_V3i_t * this_
     , Imath_V3i_t const * * return_);
 #define Imath_V3i_normalize Imath_2_5__Vec3_int__normalize
 
 
-unsigned int Imath_2_5__Vec3_int__normalized(
+IMATH_EXPORT unsigned int Imath_2_5__Vec3_int__normalized(
     Imath_V3i_t const * this_
     , Imath_V3i_t * return_);
 #define Imath_V3i_normalized Imath_2_5__Vec3_int__normalized
 
 
-
-
-
-
-
-
-
-
 #ifdef __cplusplus
 }
 #endif
@@ -33,6 +33,9 @@ pub fn Imath_2_5__Vec3_float__setValue(this_: *mut Imath_V3f_t, a: c_float, b: c
 
 pub fn Imath_2_5__Vec3_float__dot(this_: *const Imath_V3f_t, return_: *mut c_float, v: *const Imath_V3f_t) -> Exception;
 
+/// Call dot on each of the n records at this_
+pub fn Imath_2_5__Vec3_float__dot_batch(this_: *const Imath_V3f_t, v: *const Imath_V3f_t, n: usize, out: *mut c_float) -> Exception;
+
 pub fn Imath_2_5__Vec3_float__cross(this_: *const Imath_V3f_t, return_: *mut Imath_V3f_t, v: *const Imath_V3f_t) -> Exception;
 
 pub fn Imath_2_5__Vec3_float__op_iadd(this_: *mut Imath_V3f_t, return_: *mut *const Imath_V3f_t, v: *const Imath_V3f_t) -> Exception;
@@ -51,6 +54,9 @@ pub fn Imath_2_5__Vec3_int__Vec3_1(this_: *mut Imath_V3i_t, rhs: *const Imath_V3
 
 pub fn Imath_2_5__Vec3_int__dot(this_: *const Imath_V3i_t, return_: *mut c_int, v: *const Imath_V3i_t) -> Exception;
 
+/// Call dot on each of the n records at this_
+pub fn Imath_2_5__Vec3_int__dot_batch(this_: *const Imath_V3i_t, v: *const Imath_V3i_t, n: usize, out: *mut c_int) -> Exception;
+
 pub fn Imath_2_5__Vec3_int__cross(this_: *const Imath_V3i_t, return_: *mut Imath_V3i_t, v: *const Imath_V3i_t) -> Exception;
 
 pub fn Imath_2_5__Vec3_int__op_iadd(this_: *mut Imath_V3i_t, return_: *mut *const Imath_V3i_t, v: *const Imath_V3i_t) -> Exception;
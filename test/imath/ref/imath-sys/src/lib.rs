@@ -49,6 +49,7 @@ pub use imath_vec::Imath_2_5__Vec3_float__Vec3 as Imath_V3f_Vec3;
 pub use imath_vec::Imath_2_5__Vec3_float__Vec3_1 as Imath_V3f_Vec3_1;
 pub use imath_vec::Imath_2_5__Vec3_float__setValue as Imath_V3f_setValue;
 pub use imath_vec::Imath_2_5__Vec3_float__dot as Imath_V3f_dot;
+pub use imath_vec::Imath_2_5__Vec3_float__dot_batch as Imath_V3f_dot_batch;
 pub use imath_vec::Imath_2_5__Vec3_float__cross as Imath_V3f_cross;
 pub use imath_vec::Imath_2_5__Vec3_float__op_iadd as Imath_V3f_op_iadd;
 pub use imath_vec::Imath_2_5__Vec3_float__length as Imath_V3f_length;
@@ -58,6 +59,7 @@ pub use imath_vec::Imath_2_5__Vec3_float__normalized as Imath_V3f_normalized;
 pub use imath_vec::Imath_2_5__Vec3_int__Vec3 as Imath_V3i_Vec3;
 pub use imath_vec::Imath_2_5__Vec3_int__Vec3_1 as Imath_V3i_Vec3_1;
 pub use imath_vec::Imath_2_5__Vec3_int__dot as Imath_V3i_dot;
+pub use imath_vec::Imath_2_5__Vec3_int__dot_batch as Imath_V3i_dot_batch;
 pub use imath_vec::Imath_2_5__Vec3_int__cross as Imath_V3i_cross;
 pub use imath_vec::Imath_2_5__Vec3_int__op_iadd as Imath_V3i_op_iadd;
 pub use imath_vec::Imath_2_5__Vec3_int__length as Imath_V3i_length;
@@ -1,7 +1,29 @@
-// Empty dummy test file for automated testing. This will be replaced by a 
-// file copied in from the test suite
+use crate::*;
+
+fn v3f(x: f32, y: f32, z: f32) -> Imath_V3f_t {
+    Imath_V3f_t { x, y, z }
+}
 
 #[test]
-fn it_works() {
-    assert!(true, "It works!");
-}
\ No newline at end of file
+fn dot_batch() {
+    unsafe {
+        let a = [v3f(1.0, 2.0, 3.0), v3f(0.0, 1.0, 0.0), v3f(-1.0, 0.5, 2.0)];
+        let b = [v3f(4.0, 5.0, 6.0), v3f(1.0, 0.0, 0.0), v3f(2.0, 4.0, 0.25)];
+
+        let mut out = [0.0f32; 3];
+        Imath_V3f_dot_batch(a.as_ptr(), b.as_ptr(), a.len(), out.as_mut_ptr());
+        assert_eq!(out, [32.0, 0.0, 0.5]);
+
+        // Each result matches the scalar wrapper
+        for i in 0..a.len() {
+            let mut r = 0.0;
+            Imath_V3f_dot(&a[i], &mut r, &b[i]);
+            assert_eq!(out[i], r);
+        }
+
+        // Nothing is written when there's nothing to do
+        let mut untouched = [7.0f32; 1];
+        Imath_V3f_dot_batch(a.as_ptr(), b.as_ptr(), 0, untouched.as_mut_ptr());
+        assert_eq!(untouched, [7.0]);
+    }
+}
@@ -25,6 +25,16 @@ struct AllPrv {
     using BoundType = ::optr::AllPrv;
 };
 
+struct Pooled {
+    using BoundType = ::optr::Pooled;
+
+    Pooled() CPPMM_RENAME(ctor);
+    ~Pooled();
+
+    int get() const;
+
+} CPPMM_OPAQUEPTR CPPMM_POOLED;
+
 struct Opaque {
     using BoundType = ::optr::Opaque;
 } CPPMM_OPAQUETYPE;
@@ -3,8 +3,8 @@
 namespace optr {
 
 struct PubCtor {
-    PubCtor();
-    ~PubCtor();
+    PubCtor() {}
+    ~PubCtor() {}
 
     void doit() {}
 };
@@ -24,6 +24,15 @@ class AllPrv {
     void doit() {}
 };
 
+struct Pooled {
+    Pooled() : value(42) {}
+    ~Pooled() {}
+
+    int get() const { return value; }
+
+    int value;
+};
+
 class Opaque;
 
 } // namespace optr
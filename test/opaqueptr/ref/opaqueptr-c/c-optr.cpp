@@ -1,5 +1,7 @@
 #include <c-optr_private.h>
 
+#include "opaqueptr-errors-private.h"
+#include "opaqueptr-pool-private.h"
 #include <new>
 
 #include <stdexcept>
@@ -11,7 +13,18 @@ unsigned int optr__PubCtor_ctor(
         to_c(this_, new optr::PubCtor());
         return 0;
     } catch (std::exception& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
+        return -1;
+    }
+}
+unsigned int optr__PubCtor_ctor_in_place(
+    optr_PubCtor_t * this_)
+{
+    try {
+        new (this_) optr::PubCtor();
+        return 0;
+    } catch (std::exception& e) {
+        tlg_set_exception_string(e.what());
         return -1;
     }
 }
@@ -22,7 +35,18 @@ unsigned int optr__PubCtor_dtor(
         delete to_cpp(this_);
         return 0;
     } catch (std::exception& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
+        return -1;
+    }
+}
+unsigned int optr__PubCtor_drop_in_place(
+    optr_PubCtor_t * this_)
+{
+    try {
+        (to_cpp(this_)) -> optr::PubCtor::~PubCtor();
+        return 0;
+    } catch (std::exception& e) {
+        tlg_set_exception_string(e.what());
         return -1;
     }
 }
@@ -33,7 +57,7 @@ unsigned int optr__PubCtor_doit(
         (to_cpp(this_)) -> doit();
         return 0;
     } catch (std::exception& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
         return -1;
     }
 }
@@ -44,7 +68,75 @@ unsigned int optr__PrvCtor_doit(
         (to_cpp(this_)) -> doit();
         return 0;
     } catch (std::exception& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
+        return -1;
+    }
+}
+unsigned int optr__Pooled_ctor(
+    optr_Pooled_t * * this_)
+{
+    try {
+        to_c(this_, tlg_pool_new<optr::Pooled>());
+        return 0;
+    } catch (std::exception& e) {
+        tlg_set_exception_string(e.what());
+        return -1;
+    }
+}
+unsigned int optr__Pooled_ctor_arena(
+    optr_Pooled_t * * this_
+    , opaqueptr_arena_t * arena)
+{
+    try {
+        to_c(this_, tlg_arena_new<optr::Pooled>(arena));
+        return 0;
+    } catch (std::exception& e) {
+        tlg_set_exception_string(e.what());
+        return -1;
+    }
+}
+unsigned int optr__Pooled_ctor_in_place(
+    optr_Pooled_t * this_)
+{
+    try {
+        new (this_) optr::Pooled();
+        return 0;
+    } catch (std::exception& e) {
+        tlg_set_exception_string(e.what());
+        return -1;
+    }
+}
+unsigned int optr__Pooled_dtor(
+    optr_Pooled_t * this_)
+{
+    try {
+        tlg_pool_delete(to_cpp(this_));
+        return 0;
+    } catch (std::exception& e) {
+        tlg_set_exception_string(e.what());
+        return -1;
+    }
+}
+unsigned int optr__Pooled_drop_in_place(
+    optr_Pooled_t * this_)
+{
+    try {
+        (to_cpp(this_)) -> optr::Pooled::~Pooled();
+        return 0;
+    } catch (std::exception& e) {
+        tlg_set_exception_string(e.what());
+        return -1;
+    }
+}
+unsigned int optr__Pooled_get(
+    optr_Pooled_t const * this_
+    , int * return_)
+{
+    try {
+        *(return_) = (to_cpp(this_)) -> get();
+        return 0;
+    } catch (std::exception& e) {
+        tlg_set_exception_string(e.what());
         return -1;
     }
 }
@@ -1,4 +1,6 @@
 #pragma once
+#include "opaqueptr-export.h"
+#include "opaqueptr-pool.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -9,71 +11,110 @@ typedef struct optr__PubCtor_t_s {
 } __attribute__((aligned(1))) optr__PubCtor_t;
 typedef optr__PubCtor_t optr_PubCtor_t;
 
+#define optr__PubCtor_sizeof 1
+#define optr__PubCtor_alignof 1
+#define optr_PubCtor_sizeof optr__PubCtor_sizeof
+#define optr_PubCtor_alignof optr__PubCtor_alignof
+
 typedef struct optr__PrvCtor_t_s {
     char _unused;
 } __attribute__((aligned(1))) optr__PrvCtor_t;
 typedef optr__PrvCtor_t optr_PrvCtor_t;
 
+#define optr__PrvCtor_sizeof 1
+#define optr__PrvCtor_alignof 1
+#define optr_PrvCtor_sizeof optr__PrvCtor_sizeof
+#define optr_PrvCtor_alignof optr__PrvCtor_alignof
+
 typedef struct optr__AllPrv_t_s {
     char _unused;
 } __attribute__((aligned(1))) optr__AllPrv_t;
 typedef optr__AllPrv_t optr_AllPrv_t;
 
+#define optr__AllPrv_sizeof 1
+#define optr__AllPrv_alignof 1
+#define optr_AllPrv_sizeof optr__AllPrv_sizeof
+#define optr_AllPrv_alignof optr__AllPrv_alignof
+
+typedef struct optr__Pooled_t_s {
+    char _unused;
+} __attribute__((aligned(4))) optr__Pooled_t;
+typedef optr__Pooled_t optr_Pooled_t;
+
+#define optr__Pooled_sizeof 4
+#define optr__Pooled_alignof 4
+#define optr_Pooled_sizeof optr__Pooled_sizeof
+#define optr_Pooled_alignof optr__Pooled_alignof
+
 typedef struct optr__Opaque_t_s optr__Opaque_t;
 typedef optr__Opaque_t optr_Opaque_t;
 
 
 
-unsigned int optr__PubCtor_ctor(
+OPAQUEPTR_EXPORT unsigned int optr__PubCtor_ctor(
     optr_PubCtor_t * * this_);
 #define optr_PubCtor_ctor optr__PubCtor_ctor
 
 
-unsigned int optr__PubCtor_dtor(
+/** Like optr_PubCtor_ctor, but constructs into this_, which must point to optr_PubCtor_sizeof bytes aligned to optr_PubCtor_alignof */
+OPAQUEPTR_EXPORT unsigned int optr__PubCtor_ctor_in_place(
     optr_PubCtor_t * this_);
-#define optr_PubCtor_dtor optr__PubCtor_dtor
+#define optr_PubCtor_ctor_in_place optr__PubCtor_ctor_in_place
 
 
-unsigned int optr__PubCtor_doit(
+OPAQUEPTR_EXPORT unsigned int optr__PubCtor_dtor(
     optr_PubCtor_t * this_);
-#define optr_PubCtor_doit optr__PubCtor_doit
-
-
-
-
+#define optr_PubCtor_dtor optr__PubCtor_dtor
 
 
+/** Like optr_PubCtor_dtor, but leaves the storage at this_ to the caller */
+OPAQUEPTR_EXPORT unsigned int optr__PubCtor_drop_in_place(
+    optr_PubCtor_t * this_);
+#define optr_PubCtor_drop_in_place optr__PubCtor_drop_in_place
 
 
+OPAQUEPTR_EXPORT unsigned int optr__PubCtor_doit(
+    optr_PubCtor_t * this_);
+#define optr_PubCtor_doit optr__PubCtor_doit
 
 
-unsigned int optr__PrvCtor_doit(
+OPAQUEPTR_EXPORT unsigned int optr__PrvCtor_doit(
     optr_PrvCtor_t * this_);
 #define optr_PrvCtor_doit optr__PrvCtor_doit
 
 
+OPAQUEPTR_EXPORT unsigned int optr__Pooled_ctor(
+    optr_Pooled_t * * this_);
+#define optr_Pooled_ctor optr__Pooled_ctor
 
 
+OPAQUEPTR_EXPORT unsigned int optr__Pooled_ctor_arena(
+    optr_Pooled_t * * this_
+    , opaqueptr_arena_t * arena);
+#define optr_Pooled_ctor_arena optr__Pooled_ctor_arena
 
 
+/** Like optr_Pooled_ctor, but constructs into this_, which must point to optr_Pooled_sizeof bytes aligned to optr_Pooled_alignof */
+OPAQUEPTR_EXPORT unsigned int optr__Pooled_ctor_in_place(
+    optr_Pooled_t * this_);
+#define optr_Pooled_ctor_in_place optr__Pooled_ctor_in_place
 
 
+OPAQUEPTR_EXPORT unsigned int optr__Pooled_dtor(
+    optr_Pooled_t * this_);
+#define optr_Pooled_dtor optr__Pooled_dtor
 
 
+/** Like optr_Pooled_dtor, but leaves the storage at this_ to the caller */
+OPAQUEPTR_EXPORT unsigned int optr__Pooled_drop_in_place(
+    optr_Pooled_t * this_);
+#define optr_Pooled_drop_in_place optr__Pooled_drop_in_place
 
 
-
-
-
-
-
-
-
-
-
-
-
-
+OPAQUEPTR_EXPORT unsigned int optr__Pooled_get(
+    optr_Pooled_t const * this_
+    , int * return_);
+#define optr_Pooled_get optr__Pooled_get
 
 #ifdef __cplusplus
 }
@@ -1,9 +1,10 @@
 #pragma once
+#include "opaqueptr-export.h"
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-const char* opaqueptr_get_exception_string();
+OPAQUEPTR_EXPORT const char* opaqueptr_get_exception_string();
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,5 @@
+#pragma once
+
+#ifndef OPAQUEPTR_EXPORT
+#define OPAQUEPTR_EXPORT __attribute__((visibility("default")))
+#endif
@@ -0,0 +1,117 @@
+#pragma once
+#include "opaqueptr-pool.h"
+#include <cstddef>
+#include <new>
+#include <utility>
+
+#ifndef TLG_POOL_CACHE_SIZE
+#define TLG_POOL_CACHE_SIZE 64
+#endif
+
+struct alignas(std::max_align_t) tlg_pool_header {
+    // The arena the object was allocated from, or null for the pool
+    opaqueptr_arena_t* arena;
+};
+
+void* tlg_arena_allocate(opaqueptr_arena_t* arena, size_t bytes);
+
+// A per-thread cache of freed blocks for each pooled type, so that creating
+// and destroying objects doesn't contend on the global allocator. Blocks can
+// be freed on any thread, and each thread keeps at most TLG_POOL_CACHE_SIZE.
+template <typename T> class tlg_pool {
+    static_assert(alignof(T) <= alignof(std::max_align_t),
+                  "over-aligned types cannot be pooled");
+
+    struct Block {
+        Block* next;
+    };
+
+    struct Cache {
+        Block* head = nullptr;
+        size_t count = 0;
+
+        ~Cache() {
+            while (head) {
+                Block* block = head;
+                head = head->next;
+                ::operator delete(block);
+            }
+        }
+    };
+
+    static Cache& cache() {
+        static thread_local Cache c;
+        return c;
+    }
+
+public:
+    static constexpr size_t size = sizeof(tlg_pool_header) + sizeof(T);
+
+    static void* allocate() {
+        Cache& c = cache();
+        if (c.head) {
+            Block* block = c.head;
+            c.head = block->next;
+            --c.count;
+            return block;
+        }
+        return ::operator new(size);
+    }
+
+    static void deallocate(void* p) {
+        Cache& c = cache();
+        if (c.count < TLG_POOL_CACHE_SIZE) {
+            Block* block = static_cast<Block*>(p);
+            block->next = c.head;
+            c.head = block;
+            ++c.count;
+        } else {
+            ::operator delete(p);
+        }
+    }
+};
+
+// Hands the block back to the pool if construction throws
+template <typename T> struct tlg_pool_guard {
+    void* block;
+
+    ~tlg_pool_guard() {
+        if (block) {
+            tlg_pool<T>::deallocate(block);
+        }
+    }
+};
+
+template <typename T> T* tlg_pool_object(void* block, opaqueptr_arena_t* arena) {
+    static_cast<tlg_pool_header*>(block)->arena = arena;
+    return reinterpret_cast<T*>(static_cast<char*>(block) +
+                                sizeof(tlg_pool_header));
+}
+
+template <typename T, typename... Args> T* tlg_pool_new(Args&&... args) {
+    tlg_pool_guard<T> guard{tlg_pool<T>::allocate()};
+    T* object = new (tlg_pool_object<T>(guard.block, nullptr))
+        T(std::forward<Args>(args)...);
+    guard.block = nullptr;
+    return object;
+}
+
+template <typename T, typename... Args>
+T* tlg_arena_new(opaqueptr_arena_t* arena, Args&&... args) {
+    void* block = tlg_arena_allocate(arena, tlg_pool<T>::size);
+    return new (tlg_pool_object<T>(block, arena))
+        T(std::forward<Args>(args)...);
+}
+
+template <typename T> void tlg_pool_delete(T* object) {
+    if (!object) {
+        return;
+    }
+
+    object->~T();
+
+    void* block = reinterpret_cast<char*>(object) - sizeof(tlg_pool_header);
+    if (!static_cast<tlg_pool_header*>(block)->arena) {
+        tlg_pool<T>::deallocate(block);
+    }
+}
@@ -0,0 +1,78 @@
+#include "opaqueptr-pool-private.h"
+
+// The arena's memory is a list of chunks, newest first, each starting with
+// this header. Allocations are bumped out of the newest chunk.
+struct tlg_arena_chunk {
+    tlg_arena_chunk* next;
+    size_t size;
+};
+
+struct opaqueptr_arena_s {
+    tlg_arena_chunk* chunks;
+    char* cursor;
+    char* end;
+    size_t chunk_size;
+};
+
+static const size_t TLG_CHUNK_HEADER_SIZE =
+    (sizeof(tlg_arena_chunk) + alignof(std::max_align_t) - 1) &
+    ~(alignof(std::max_align_t) - 1);
+
+static void tlg_arena_add_chunk(opaqueptr_arena_t* arena, size_t bytes) {
+    const size_t size = bytes > arena->chunk_size ? bytes : arena->chunk_size;
+    auto* chunk = static_cast<tlg_arena_chunk*>(
+        ::operator new(TLG_CHUNK_HEADER_SIZE + size));
+    chunk->next = arena->chunks;
+    chunk->size = size;
+    arena->chunks = chunk;
+    arena->cursor = reinterpret_cast<char*>(chunk) + TLG_CHUNK_HEADER_SIZE;
+    arena->end = arena->cursor + size;
+}
+
+void* tlg_arena_allocate(opaqueptr_arena_t* arena, size_t bytes) {
+    // Keep every allocation aligned for any type
+    bytes = (bytes + alignof(std::max_align_t) - 1) &
+            ~(alignof(std::max_align_t) - 1);
+    if (static_cast<size_t>(arena->end - arena->cursor) < bytes) {
+        tlg_arena_add_chunk(arena, bytes);
+    }
+    void* result = arena->cursor;
+    arena->cursor += bytes;
+    return result;
+}
+
+opaqueptr_arena_t* opaqueptr_arena_create(unsigned long chunk_size) {
+    auto* arena = new opaqueptr_arena_t;
+    arena->chunks = nullptr;
+    arena->cursor = nullptr;
+    arena->end = nullptr;
+    arena->chunk_size = chunk_size ? chunk_size : 64 * 1024;
+    return arena;
+}
+
+void opaqueptr_arena_reset(opaqueptr_arena_t* arena) {
+    if (!arena->chunks) {
+        return;
+    }
+
+    // Keep the oldest chunk, which is the one made with the arena's chunk size
+    tlg_arena_chunk* chunk = arena->chunks;
+    while (chunk->next) {
+        tlg_arena_chunk* next = chunk->next;
+        ::operator delete(chunk);
+        chunk = next;
+    }
+    arena->chunks = chunk;
+    arena->cursor = reinterpret_cast<char*>(chunk) + TLG_CHUNK_HEADER_SIZE;
+    arena->end = arena->cursor + chunk->size;
+}
+
+void opaqueptr_arena_destroy(opaqueptr_arena_t* arena) {
+    tlg_arena_chunk* chunk = arena->chunks;
+    while (chunk) {
+        tlg_arena_chunk* next = chunk->next;
+        ::operator delete(chunk);
+        chunk = next;
+    }
+    delete arena;
+}
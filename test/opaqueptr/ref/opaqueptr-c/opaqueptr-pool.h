@@ -0,0 +1,23 @@
+#pragma once
+#include "opaqueptr-export.h"
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// A bump allocator that the _arena constructors of pooled records allocate
+/// from. An arena must only be used by one thread at a time.
+typedef struct opaqueptr_arena_s opaqueptr_arena_t;
+
+/// Create an arena that allocates chunk_size bytes at a time (64KiB if 0)
+OPAQUEPTR_EXPORT opaqueptr_arena_t* opaqueptr_arena_create(unsigned long chunk_size);
+
+/// Free everything allocated from the arena at once, keeping its first chunk
+/// for reuse. Objects allocated from it must have been destroyed already.
+OPAQUEPTR_EXPORT void opaqueptr_arena_reset(opaqueptr_arena_t* arena);
+
+/// Free the arena and everything allocated from it
+OPAQUEPTR_EXPORT void opaqueptr_arena_destroy(opaqueptr_arena_t* arena);
+
+#ifdef __cplusplus
+}
+#endif
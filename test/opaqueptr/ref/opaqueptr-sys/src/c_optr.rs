@@ -9,14 +9,34 @@ use std::os::raw::*;
 pub struct optr__PubCtor_t {
     _unused: [u8; 0],
 }
+
+pub const optr__PubCtor_sizeof: usize = 1;
+pub const optr__PubCtor_alignof: usize = 1;
+
 #[repr(C)]
 pub struct optr__PrvCtor_t {
     _unused: [u8; 0],
 }
+
+pub const optr__PrvCtor_sizeof: usize = 1;
+pub const optr__PrvCtor_alignof: usize = 1;
+
 #[repr(C)]
 pub struct optr__AllPrv_t {
     _unused: [u8; 0],
 }
+
+pub const optr__AllPrv_sizeof: usize = 1;
+pub const optr__AllPrv_alignof: usize = 1;
+
+#[repr(C)]
+pub struct optr__Pooled_t {
+    _unused: [u8; 0],
+}
+
+pub const optr__Pooled_sizeof: usize = 4;
+pub const optr__Pooled_alignof: usize = 4;
+
 #[repr(C)]
 pub struct optr__Opaque_t {
     _unused: [u8; 0],
@@ -27,11 +47,31 @@ extern "C" {
 
 pub fn optr__PubCtor_ctor(this_: *mut *mut optr_PubCtor_t) -> Exception;
 
+/// Like optr_PubCtor_ctor, but constructs into this_, which must point to optr_PubCtor_sizeof bytes aligned to optr_PubCtor_alignof
+pub fn optr__PubCtor_ctor_in_place(this_: *mut optr_PubCtor_t) -> Exception;
+
 pub fn optr__PubCtor_dtor(this_: *mut optr_PubCtor_t) -> Exception;
 
+/// Like optr_PubCtor_dtor, but leaves the storage at this_ to the caller
+pub fn optr__PubCtor_drop_in_place(this_: *mut optr_PubCtor_t) -> Exception;
+
 pub fn optr__PubCtor_doit(this_: *mut optr_PubCtor_t) -> Exception;
 
 pub fn optr__PrvCtor_doit(this_: *mut optr_PrvCtor_t) -> Exception;
 
+pub fn optr__Pooled_ctor(this_: *mut *mut optr_Pooled_t) -> Exception;
+
+pub fn optr__Pooled_ctor_arena(this_: *mut *mut optr_Pooled_t, arena: *mut opaqueptr_arena_t) -> Exception;
+
+/// Like optr_Pooled_ctor, but constructs into this_, which must point to optr_Pooled_sizeof bytes aligned to optr_Pooled_alignof
+pub fn optr__Pooled_ctor_in_place(this_: *mut optr_Pooled_t) -> Exception;
+
+pub fn optr__Pooled_dtor(this_: *mut optr_Pooled_t) -> Exception;
+
+/// Like optr_Pooled_dtor, but leaves the storage at this_ to the caller
+pub fn optr__Pooled_drop_in_place(this_: *mut optr_Pooled_t) -> Exception;
+
+pub fn optr__Pooled_get(this_: *const optr_Pooled_t, return_: *mut c_int) -> Exception;
+
 
 } // extern "C"
@@ -41,16 +41,49 @@ extern {
     pub fn opaqueptr_get_exception_string() -> *const std::os::raw::c_char;
 }
 
+
+/// A bump allocator that the _arena constructors of pooled records allocate
+/// from. An arena must only be used by one thread at a time.
+#[repr(C)]
+pub struct opaqueptr_arena_t {
+    _unused: [u8; 0],
+}
+
+extern {
+    pub fn opaqueptr_arena_create(
+        chunk_size: std::os::raw::c_ulong,
+    ) -> *mut opaqueptr_arena_t;
+    pub fn opaqueptr_arena_reset(arena: *mut opaqueptr_arena_t);
+    pub fn opaqueptr_arena_destroy(arena: *mut opaqueptr_arena_t);
+}
+
 pub mod c_optr;
 pub use c_optr::optr__PubCtor_t as optr_PubCtor_t;
+pub use c_optr::optr__PubCtor_sizeof as optr_PubCtor_sizeof;
+pub use c_optr::optr__PubCtor_alignof as optr_PubCtor_alignof;
 pub use c_optr::optr__PrvCtor_t as optr_PrvCtor_t;
+pub use c_optr::optr__PrvCtor_sizeof as optr_PrvCtor_sizeof;
+pub use c_optr::optr__PrvCtor_alignof as optr_PrvCtor_alignof;
 pub use c_optr::optr__AllPrv_t as optr_AllPrv_t;
+pub use c_optr::optr__AllPrv_sizeof as optr_AllPrv_sizeof;
+pub use c_optr::optr__AllPrv_alignof as optr_AllPrv_alignof;
+pub use c_optr::optr__Pooled_t as optr_Pooled_t;
+pub use c_optr::optr__Pooled_sizeof as optr_Pooled_sizeof;
+pub use c_optr::optr__Pooled_alignof as optr_Pooled_alignof;
 pub use c_optr::optr__Opaque_t as optr_Opaque_t;
 
 pub use c_optr::optr__PubCtor_ctor as optr_PubCtor_ctor;
+pub use c_optr::optr__PubCtor_ctor_in_place as optr_PubCtor_ctor_in_place;
 pub use c_optr::optr__PubCtor_dtor as optr_PubCtor_dtor;
+pub use c_optr::optr__PubCtor_drop_in_place as optr_PubCtor_drop_in_place;
 pub use c_optr::optr__PubCtor_doit as optr_PubCtor_doit;
 pub use c_optr::optr__PrvCtor_doit as optr_PrvCtor_doit;
+pub use c_optr::optr__Pooled_ctor as optr_Pooled_ctor;
+pub use c_optr::optr__Pooled_ctor_arena as optr_Pooled_ctor_arena;
+pub use c_optr::optr__Pooled_ctor_in_place as optr_Pooled_ctor_in_place;
+pub use c_optr::optr__Pooled_dtor as optr_Pooled_dtor;
+pub use c_optr::optr__Pooled_drop_in_place as optr_Pooled_drop_in_place;
+pub use c_optr::optr__Pooled_get as optr_Pooled_get;
 
 
 #[cfg(test)]
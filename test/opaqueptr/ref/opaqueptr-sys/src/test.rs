@@ -1,7 +1,73 @@
-// Empty dummy test file for automated testing. This will be replaced by a 
-// file copied in from the test suite
+use crate::*;
+
+unsafe fn get(p: *const optr_Pooled_t) -> i32 {
+    let mut value = 0;
+    optr_Pooled_get(p, &mut value);
+    value
+}
 
 #[test]
 fn it_works() {
-    assert!(true, "It works!");
-}
\ No newline at end of file
+    unsafe {
+        let mut p = std::ptr::null_mut();
+        optr_PubCtor_ctor(&mut p);
+        optr_PubCtor_doit(p);
+        optr_PubCtor_dtor(p);
+    }
+}
+
+#[test]
+fn pooled() {
+    unsafe {
+        let mut a = std::ptr::null_mut();
+        optr_Pooled_ctor(&mut a);
+        assert_eq!(get(a), 42);
+        optr_Pooled_dtor(a);
+
+        // The freed block is cached for the next object on this thread
+        let mut b = std::ptr::null_mut();
+        optr_Pooled_ctor(&mut b);
+        assert_eq!(b, a);
+        assert_eq!(get(b), 42);
+
+        let mut c = std::ptr::null_mut();
+        optr_Pooled_ctor(&mut c);
+        assert_ne!(c, b);
+        assert_eq!(get(c), 42);
+
+        optr_Pooled_dtor(c);
+        optr_Pooled_dtor(b);
+    }
+}
+
+#[test]
+fn arena() {
+    unsafe {
+        // A small chunk size, so that the objects span several chunks
+        let arena = opaqueptr_arena_create(64);
+        assert!(!arena.is_null());
+
+        for _ in 0..2 {
+            let mut objects = Vec::new();
+            for _ in 0..16 {
+                let mut p = std::ptr::null_mut();
+                optr_Pooled_ctor_arena(&mut p, arena);
+                assert_eq!(get(p), 42);
+                objects.push(p);
+            }
+
+            // Destroying an arena object doesn't free it, that's left to
+            // the reset
+            for p in objects {
+                optr_Pooled_dtor(p);
+            }
+            opaqueptr_arena_reset(arena);
+        }
+
+        // Anything left in the arena is freed along with it
+        let mut p = std::ptr::null_mut();
+        optr_Pooled_ctor_arena(&mut p, arena);
+        assert_eq!(get(p), 42);
+        opaqueptr_arena_destroy(arena);
+    }
+}
@@ -1,5 +1,6 @@
 #include <c-renum_private.h>
 
+#include "rustify_enum-errors-private.h"
 
 #include <stdexcept>
 
@@ -1,4 +1,5 @@
 #pragma once
+#include "rustify_enum-export.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -37,30 +38,6 @@ typedef unsigned int rustify_RgbaChannels;
 
 
 
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
 #ifdef __cplusplus
 }
 #endif
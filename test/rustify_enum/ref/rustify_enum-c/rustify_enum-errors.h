@@ -1,9 +1,10 @@
 #pragma once
+#include "rustify_enum-export.h"
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-const char* rustify_enum_get_exception_string();
+RUSTIFY_ENUM_EXPORT const char* rustify_enum_get_exception_string();
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,5 @@
+#pragma once
+
+#ifndef RUSTIFY_ENUM_EXPORT
+#define RUSTIFY_ENUM_EXPORT __attribute__((visibility("default")))
+#endif
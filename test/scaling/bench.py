@@ -0,0 +1,100 @@
+"""Time astgen and asttoc on synthetic libraries of increasing size
+
+Generates a library with gen.py for each value of the swept parameter, runs
+astgen and asttoc over it, and writes the wall time and peak RSS of each to a
+JSON report. Each step also gets the exponent of its growth in time relative
+to the previous size, so anything much above 1 points at quadratic behaviour.
+"""
+import argparse
+import json
+import math
+import os
+import subprocess
+import sys
+import time
+
+import gen
+
+
+def run(args):
+    """Run args to completion, returning its wall time and peak RSS in KiB"""
+    start = time.perf_counter()
+    proc = subprocess.Popen(args, stdout=subprocess.PIPE,
+                            stderr=subprocess.STDOUT)
+    output = proc.stdout.read()
+    _, status, usage = os.wait4(proc.pid, 0)
+    seconds = time.perf_counter() - start
+    code = os.WEXITSTATUS(status) if os.WIFEXITED(status) else 255
+
+    if code != 0:
+        print(output.decode(errors='replace'))
+        print('{} exited with non-zero return code {}'.format(args[0], code))
+        sys.exit(code)
+
+    # ru_maxrss is in KiB on Linux but bytes on macOS
+    max_rss = usage.ru_maxrss
+    if sys.platform == 'darwin':
+        max_rss //= 1024
+
+    return {'seconds': round(seconds, 3), 'max_rss_kb': max_rss}
+
+
+def exponent(prev, cur, phase, param):
+    t0 = prev[phase]['seconds']
+    t1 = cur[phase]['seconds']
+    if t0 <= 0 or t1 <= 0 or prev[param] == cur[param]:
+        return None
+    return round(math.log(t1 / t0) / math.log(cur[param] / prev[param]), 2)
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('astgen')
+    parser.add_argument('asttoc')
+    parser.add_argument('output_dir')
+    parser.add_argument('--sweep', choices=['n', 'm', 'k', 'd', 'f'],
+                        default='n', help='parameter to scale')
+    parser.add_argument('--sizes', default='10,20,40,80',
+                        help='comma-separated values of the swept parameter')
+    parser.add_argument('-n', type=int, default=10, help='classes')
+    parser.add_argument('-m', type=int, default=10, help='methods per class')
+    parser.add_argument('-k', type=int, default=2,
+                        help='template instantiations per class')
+    parser.add_argument('-d', type=int, default=1, help='inheritance depth')
+    parser.add_argument('-f', type=int, default=1,
+                        help='overloads of each method')
+    parser.add_argument('--report', help='JSON file to write the results to. '
+                        'Defaults to <output_dir>/report.json')
+    args = parser.parse_args()
+
+    params = {p: getattr(args, p) for p in 'nmkdf'}
+    results = []
+    for size in [int(s) for s in args.sizes.split(',')]:
+        params[args.sweep] = size
+        step_dir = os.path.join(args.output_dir,
+                                '{}{}'.format(args.sweep, size))
+        gen.generate(step_dir, **params)
+
+        ast_dir = os.path.join(step_dir, 'ast')
+        result = dict(params)
+        result['astgen'] = run([args.astgen, os.path.join(step_dir, 'bind'),
+                                '-o', ast_dir, '--',
+                                '-I' + os.path.join(step_dir, 'include')])
+        result['asttoc'] = run([args.asttoc, ast_dir, '-o', step_dir,
+                                '-p', 'synth'])
+
+        if results:
+            for phase in ['astgen', 'asttoc']:
+                result[phase]['exponent'] = exponent(results[-1], result,
+                                                     phase, args.sweep)
+
+        print('{}={}: astgen {}s {}KiB, asttoc {}s {}KiB'.format(
+            args.sweep, size, result['astgen']['seconds'],
+            result['astgen']['max_rss_kb'], result['asttoc']['seconds'],
+            result['asttoc']['max_rss_kb']))
+        results.append(result)
+
+    report = args.report or os.path.join(args.output_dir, 'report.json')
+    with open(report, 'w') as f:
+        json.dump({'sweep': args.sweep, 'results': results}, f, indent=4)
+    print('Wrote ' + report)
@@ -0,0 +1,141 @@
+"""Generate a synthetic library and its binding files for scaling benchmarks
+
+The library has N classes, each with M methods that each have F overloads, and
+sits at the bottom of an inheritance chain D deep. Each class also has a class
+template with the same methods, instantiated for K different types. Every
+class gets its own binding file, as a large real binding would.
+"""
+import argparse
+import os
+import shutil
+
+TYPES = ['int', 'float', 'double', 'short', 'long', 'char', 'unsigned int',
+         'unsigned short', 'unsigned long', 'long long', 'unsigned char',
+         'signed char']
+
+
+def type_alias(t):
+    return t.replace(' ', '_')
+
+
+def overload_params(t, f):
+    # Overload f of a method takes f + 1 arguments
+    return ', '.join('{} a{}'.format(t, i) for i in range(f + 1))
+
+
+def overload_sum(f):
+    return ' + '.join('a{}'.format(i) for i in range(f + 1))
+
+
+def base_name(c, d):
+    return 'Class{}_Base{}'.format(c, d)
+
+
+def write_header(f, n, m, k, d, fanout):
+    f.write('#pragma once\n\nnamespace synth {\n\n')
+
+    for c in range(n):
+        for b in range(d):
+            base = ' : public {}'.format(base_name(c, b - 1)) if b else ''
+            f.write('struct {}{} {{\n'.format(base_name(c, b), base))
+            f.write('    int depth{}() const {{ return {}; }}\n'.format(b, b))
+            f.write('};\n\n')
+
+        base = ' : public {}'.format(base_name(c, d - 1)) if d else ''
+        f.write('struct Class{}{} {{\n'.format(c, base))
+        f.write('    Class{}() {{}}\n'.format(c))
+        f.write('    ~Class{}() {{}}\n'.format(c))
+        for i in range(m):
+            for o in range(fanout):
+                f.write('    int method{}({}) const {{ return {}; }}\n'.format(
+                    i, overload_params('int', o), overload_sum(o)))
+        f.write('};\n\n')
+
+        f.write('template <typename T> struct Tmpl{} {{\n'.format(c))
+        f.write('    T value;\n')
+        for i in range(m):
+            for o in range(fanout):
+                f.write('    T method{}({}) const {{ return {}; }}\n'.format(
+                    i, overload_params('T', o), overload_sum(o)))
+        f.write('};\n\n')
+
+    f.write('} // namespace synth\n')
+
+
+def write_binding(f, c, m, k, d, fanout):
+    f.write('#include <synth.hpp>\n\n#include <cppmm_bind.hpp>\n\n')
+    f.write('namespace cppmm_bind {\n\nnamespace synth {\n\n')
+
+    for b in range(d):
+        base = ' : public {}'.format(base_name(c, b - 1)) if b else ''
+        f.write('struct {}{} {{\n'.format(base_name(c, b), base))
+        f.write('    using BoundType = ::synth::{};\n'.format(base_name(c, b)))
+        f.write('    int depth{}() const;\n'.format(b))
+        f.write('} CPPMM_OPAQUEPTR;\n\n')
+
+    base = ' : public {}'.format(base_name(c, d - 1)) if d else ''
+    f.write('struct Class{}{} {{\n'.format(c, base))
+    f.write('    using BoundType = ::synth::Class{};\n\n'.format(c))
+    f.write('    Class{}() CPPMM_RENAME(ctor);\n'.format(c))
+    f.write('    ~Class{}();\n\n'.format(c))
+    for i in range(m):
+        for o in range(fanout):
+            f.write('    int method{}({}) const CPPMM_RENAME(method{}_{});\n'
+                    .format(i, overload_params('int', o), i, o))
+    f.write('} CPPMM_OPAQUEPTR;\n\n')
+
+    f.write('template <typename T> struct Tmpl{} {{\n'.format(c))
+    f.write('    using BoundType = ::synth::Tmpl{}<T>;\n\n'.format(c))
+    for i in range(m):
+        for o in range(fanout):
+            f.write('    T method{}({}) const CPPMM_RENAME(method{}_{});\n'
+                    .format(i, overload_params('T', o), i, o))
+    f.write('} CPPMM_VALUETYPE;\n\n')
+
+    for t in TYPES[:k]:
+        f.write('template class Tmpl{}<{}>;\n'.format(c, t))
+    for t in TYPES[:k]:
+        f.write('using Tmpl{}_{} = ::synth::Tmpl{}<{}>;\n'.format(
+            c, type_alias(t), c, t))
+
+    f.write('\n} // namespace synth\n\n} // namespace cppmm_bind\n')
+
+    for t in TYPES[:k]:
+        f.write('\ntemplate class ::synth::Tmpl{}<{}>;'.format(c, t))
+    f.write('\n')
+
+
+def generate(output_dir, n, m, k, d, f):
+    """Write include/synth.hpp and bind/class<i>.cpp under output_dir"""
+    if k > len(TYPES):
+        raise ValueError('At most {} template instantiations are supported'
+                         .format(len(TYPES)))
+
+    shutil.rmtree(output_dir, ignore_errors=True)
+    include_dir = os.path.join(output_dir, 'include')
+    bind_dir = os.path.join(output_dir, 'bind')
+    os.makedirs(include_dir)
+    os.makedirs(bind_dir)
+
+    with open(os.path.join(include_dir, 'synth.hpp'), 'w') as out:
+        write_header(out, n, m, k, d, f)
+
+    for c in range(n):
+        path = os.path.join(bind_dir, 'class{}.cpp'.format(c))
+        with open(path, 'w') as out:
+            write_binding(out, c, m, k, d, f)
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('output_dir')
+    parser.add_argument('-n', type=int, default=10, help='classes')
+    parser.add_argument('-m', type=int, default=10, help='methods per class')
+    parser.add_argument('-k', type=int, default=2,
+                        help='template instantiations per class')
+    parser.add_argument('-d', type=int, default=1, help='inheritance depth')
+    parser.add_argument('-f', type=int, default=1,
+                        help='overloads of each method')
+    args = parser.parse_args()
+
+    generate(args.output_dir, args.n, args.m, args.k, args.d, args.f)
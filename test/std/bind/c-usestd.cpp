@@ -4,8 +4,13 @@ namespace cppmm_bind {
 
 namespace usestd {
 
+struct Tag {
+    using BoundType = ::usestd::Tag;
+} CPPMM_OPAQUEBYTES;
+
 void takes_string(const ::std::string& s);
 void takes_vector_string(const ::std::vector<::std::string>& v);
+void fill_names(::std::vector<::std::string>& v);
 
 } // namespace usestd
 
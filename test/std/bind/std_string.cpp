@@ -1,6 +1,8 @@
 #include <string>
 #include <vector>
 
+#include <usestd.hpp>
+
 #include <cppmm_bind.hpp>
 
 namespace cppmm_bind {
@@ -47,11 +49,17 @@ public:
 
 // explicit instantiation
 template class vector<::std::string>;
+template class vector<float>;
+template class vector<::usestd::Tag>;
 
 using vector_string = ::std::vector<::std::string>;
+using vector_float = ::std::vector<float>;
+using vector_tag = ::std::vector<::usestd::Tag>;
 
 } // namespace std
 
 } // namespace cppmm_bind
 
 template class std::vector<std::string>;
+template class std::vector<float>;
+template class std::vector<usestd::Tag>;
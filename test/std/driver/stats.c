@@ -0,0 +1,75 @@
+/* Makes a known set of calls into the instrumented std library and checks
+ * that std_stats_dump reports exactly those */
+#include <std-stats.h>
+#include <std_string.h>
+
+#include <stdio.h>
+#include <string.h>
+
+#define CHECK(cond)                                                           \
+    if (!(cond)) {                                                            \
+        fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__,     \
+                #cond);                                                       \
+        return 1;                                                             \
+    }
+
+static const char* const expected[] = {
+    "std_vector_float_vector 1\n",
+    "std_vector_float_dtor 1\n",
+    "std_vector_float_size 2\n",
+    "std_vector_float_resize 3\n",
+};
+
+static const int num_expected = sizeof(expected) / sizeof(expected[0]);
+
+int main(void) {
+    std_vector_float_t* floats = NULL;
+    size_t size = 0;
+    size_t i = 0;
+    char line[256];
+    int lines = 0;
+    int found = 0;
+    FILE* file = NULL;
+
+    /* Nothing has been called yet, so nothing is reported */
+    std_stats_dump("stats.txt");
+    file = fopen("stats.txt", "r");
+    CHECK(file);
+    CHECK(!fgets(line, sizeof(line), file));
+    fclose(file);
+
+    CHECK(std_vector_float_vector(&floats) == 0);
+    for (i = 1; i <= 3; ++i) {
+        CHECK(std_vector_float_resize(floats, i) == 0);
+    }
+    CHECK(std_vector_float_size(floats, &size) == 0);
+    CHECK(std_vector_float_size(floats, &size) == 0);
+    CHECK(size == 3);
+    CHECK(std_vector_float_dtor(floats) == 0);
+
+    std_stats_dump("stats.txt");
+    file = fopen("stats.txt", "r");
+    CHECK(file);
+    while (fgets(line, sizeof(line), file)) {
+        int j;
+        ++lines;
+        for (j = 0; j < num_expected; ++j) {
+            if (strcmp(line, expected[j]) == 0) {
+                ++found;
+            }
+        }
+    }
+    fclose(file);
+    CHECK(lines == num_expected);
+    CHECK(found == num_expected);
+
+    /* Resetting zeroes every counter */
+    std_stats_reset();
+    std_stats_dump("stats.txt");
+    file = fopen("stats.txt", "r");
+    CHECK(file);
+    CHECK(!fgets(line, sizeof(line), file));
+    fclose(file);
+
+    return 0;
+}
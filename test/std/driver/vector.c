@@ -0,0 +1,46 @@
+/* Calls into the generated std library from C, to check that it links and
+ * works in the configuration under test */
+#include <c-usestd.h>
+#include <std_string.h>
+
+#include <stdio.h>
+#include <string.h>
+
+#define CHECK(cond)                                                           \
+    if (!(cond)) {                                                            \
+        fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__,     \
+                #cond);                                                       \
+        return 1;                                                             \
+    }
+
+int main(void) {
+    std_vector_float_t* floats = NULL;
+    std_vector_string_t* names = NULL;
+    const float values[3] = {1.0f, 2.0f, 3.0f};
+    float copied[3] = {0.0f, 0.0f, 0.0f};
+    char buffer[16];
+    size_t offsets[4];
+    size_t size = 0;
+    size_t bytes = 0;
+    size_t count = 0;
+
+    CHECK(std_vector_float_vector(&floats) == 0);
+    CHECK(std_vector_float_assign_from(floats, values, 3) == 0);
+    CHECK(std_vector_float_size(floats, &size) == 0);
+    CHECK(size == 3);
+    CHECK(std_vector_float_copy_to(floats, copied, 3) == 0);
+    CHECK(memcmp(values, copied, sizeof(values)) == 0);
+    CHECK(std_vector_float_dtor(floats) == 0);
+
+    CHECK(std_vector_string_vector(&names) == 0);
+    CHECK(usestd_fill_names(names) == 0);
+    CHECK(std_vector_string_string_table(names, buffer, sizeof(buffer),
+                                         offsets, 4, &bytes, &count) == 0);
+    CHECK(bytes == 10);
+    CHECK(count == 3);
+    CHECK(memcmp(buffer, "alphagamma", 10) == 0);
+    CHECK(offsets[1] == 5 && offsets[2] == 5 && offsets[3] == 10);
+    CHECK(std_vector_string_dtor(names) == 0);
+
+    return 0;
+}
@@ -1,9 +1,19 @@
+#pragma once
+
 #include <string>
 #include <vector>
 
 namespace usestd {
 
-void takes_string(const std::string& s) {}
-void takes_vector_string(const std::vector<std::string>& v) {}
+struct Tag {
+    int id;
+    float weight;
+};
+
+inline void takes_string(const std::string& s) {}
+inline void takes_vector_string(const std::vector<std::string>& v) {}
+inline void fill_names(std::vector<std::string>& v) {
+    v = {"alpha", "", "gamma"};
+}
 
 } // namespace usestd
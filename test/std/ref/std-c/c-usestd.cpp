@@ -1,5 +1,6 @@
 #include <c-usestd_private.h>
 
+#include "std-errors-private.h"
 #include <std_string_private.h>
 
 #include <stdexcept>
@@ -11,7 +12,7 @@ unsigned int usestd_takes_string(
         usestd::takes_string(to_cpp_ref(s));
         return 0;
     } catch (std::exception& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
         return -1;
     }
 }
@@ -22,7 +23,18 @@ unsigned int usestd_takes_vector_string(
         usestd::takes_vector_string(to_cpp_ref(v));
         return 0;
     } catch (std::exception& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
+        return -1;
+    }
+}
+unsigned int usestd_fill_names(
+    std_vector_string_t * v)
+{
+    try {
+        usestd::fill_names(to_cpp_ref(v));
+        return 0;
+    } catch (std::exception& e) {
+        tlg_set_exception_string(e.what());
         return -1;
     }
 }
@@ -1,4 +1,5 @@
 #pragma once
+#include "std-export.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -9,12 +10,22 @@ typedef std____cxx11__basic_string_char__t std_string_t;
 typedef struct std__vector_std__string__t_s std__vector_std__string__t;
 typedef std__vector_std__string__t std_vector_string_t;
 
+typedef struct usestd__Tag_t_s {
+    char data[8];
+} __attribute__((aligned(4))) usestd__Tag_t;
+typedef usestd__Tag_t usestd_Tag_t;
 
-unsigned int usestd_takes_string(
+
+
+
+STD_EXPORT unsigned int usestd_takes_string(
     std_string_t const * s);
 
-unsigned int usestd_takes_vector_string(
+STD_EXPORT unsigned int usestd_takes_vector_string(
     std_vector_string_t const * v);
+
+STD_EXPORT unsigned int usestd_fill_names(
+    std_vector_string_t * v);
 #ifdef __cplusplus
 }
 #endif
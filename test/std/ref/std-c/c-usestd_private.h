@@ -2,10 +2,21 @@
 #include <c-usestd.h>
 
 
-#include "std-errors-private.h"
-
+#include "std-cast-private.h"
 #include <cstring>
 #include <usestd.hpp>
 
+namespace cppmm {
+template <> struct cast_from_c<usestd_Tag_t> : cast<usestd_Tag_t, usestd::Tag> {};
+} // namespace cppmm
+
+
+inline void to_c_copy(
+    usestd_Tag_t * lhs
+    , usestd::Tag const & rhs)
+{
+        memcpy(lhs, &(rhs), sizeof(*(lhs)));
+}
+
 
 
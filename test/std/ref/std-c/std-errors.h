@@ -1,9 +1,10 @@
 #pragma once
+#include "std-export.h"
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-const char* std_get_exception_string();
+STD_EXPORT const char* std_get_exception_string();
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,5 @@
+#pragma once
+
+#ifndef STD_EXPORT
+#define STD_EXPORT __attribute__((visibility("default")))
+#endif
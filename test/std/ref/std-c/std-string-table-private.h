@@ -0,0 +1,28 @@
+#pragma once
+#include <cstring>
+
+// Pack a container of strings into one buffer. See the string_table()
+// wrappers for a description of the parameters.
+template <typename T>
+void tlg_string_table(const T& strings, char* buffer,
+                      size_t buffer_len, size_t* offsets,
+                      size_t offsets_len, size_t* bytes, size_t* count) {
+    size_t total = 0;
+    for (const auto& s : strings) {
+        total += s.size();
+    }
+
+    *bytes = total;
+    *count = strings.size();
+    if (buffer_len < total || offsets_len < strings.size() + 1) {
+        return;
+    }
+
+    size_t offset = 0;
+    for (const auto& s : strings) {
+        *offsets++ = offset;
+        std::memcpy(buffer + offset, s.data(), s.size());
+        offset += s.size();
+    }
+    *offsets = offset;
+}
@@ -1,5 +1,7 @@
 #include <std_set_private.h>
 
+#include "std-errors-private.h"
+#include "std-string-table-private.h"
 #include <new>
 #include <std_string_private.h>
 
@@ -12,7 +14,18 @@ unsigned int std__set_std__string__ctor(
         to_c(this_, new std::set<std::string>());
         return 0;
     } catch (std::exception& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
+        return -1;
+    }
+}
+unsigned int std__set_std__string__ctor_in_place(
+    std_set_string_t * this_)
+{
+    try {
+        new (this_) std::set<std::string>();
+        return 0;
+    } catch (std::exception& e) {
+        tlg_set_exception_string(e.what());
         return -1;
     }
 }
@@ -23,7 +36,18 @@ unsigned int std__set_std__string__dtor(
         delete to_cpp(this_);
         return 0;
     } catch (std::exception& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
+        return -1;
+    }
+}
+unsigned int std__set_std__string__drop_in_place(
+    std_set_string_t * this_)
+{
+    try {
+        (to_cpp(this_)) -> std::set<std::__cxx11::basic_string<char>, std::less<std::__cxx11::basic_string<char> >, std::allocator<std::__cxx11::basic_string<char> > >::~set();
+        return 0;
+    } catch (std::exception& e) {
+        tlg_set_exception_string(e.what());
         return -1;
     }
 }
@@ -35,7 +59,7 @@ unsigned int std__set_std__string__cbegin(
         to_c_copy(return_, (to_cpp(this_)) -> cbegin());
         return 0;
     } catch (std::exception& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
         return -1;
     }
 }
@@ -47,7 +71,7 @@ unsigned int std__set_std__string__cend(
         to_c_copy(return_, (to_cpp(this_)) -> cend());
         return 0;
     } catch (std::exception& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
         return -1;
     }
 }
@@ -59,7 +83,24 @@ unsigned int std__set_std__string__size(
         *(return_) = (to_cpp(this_)) -> size();
         return 0;
     } catch (std::exception& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
+        return -1;
+    }
+}
+unsigned int std__set_std__string__string_table(
+    std_set_string_t const * this_
+    , char * buffer
+    , size_t buffer_len
+    , size_t * offsets
+    , size_t offsets_len
+    , size_t * bytes
+    , size_t * count)
+{
+    try {
+        tlg_string_table(*(to_cpp(this_)), buffer, buffer_len, offsets, offsets_len, bytes, count);
+        return 0;
+    } catch (std::exception& e) {
+        tlg_set_exception_string(e.what());
         return -1;
     }
 }
@@ -71,7 +112,7 @@ unsigned int std___Rb_tree_const_iterator_std____cxx11__basic_string_char___dere
         to_c(return_, (to_cpp(this_)) -> operator*());
         return 0;
     } catch (std::exception& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
         return -1;
     }
 }
@@ -83,7 +124,7 @@ unsigned int std___Rb_tree_const_iterator_std____cxx11__basic_string_char___inc(
         to_c(return_, (to_cpp(this_)) -> operator++());
         return 0;
     } catch (std::exception& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
         return -1;
     }
 }
@@ -96,7 +137,7 @@ unsigned int std_set_string_const_iterator_eq(
         *(return_) = (to_cpp_ref(__x) == to_cpp_ref(__y));
         return 0;
     } catch (std::exception& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
         return -1;
     }
 }
@@ -1,5 +1,7 @@
 #pragma once
+#include "std-export.h"
 #include <stdbool.h>
+#include <stddef.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -13,11 +15,21 @@ typedef struct std___Rb_tree_node_base_t_s {
 } __attribute__((aligned(8))) std___Rb_tree_node_base_t;
 typedef std___Rb_tree_node_base_t std__Rb_tree_node_base_t;
 
+#define std___Rb_tree_node_base_sizeof 32
+#define std___Rb_tree_node_base_alignof 8
+#define std__Rb_tree_node_base_sizeof std___Rb_tree_node_base_sizeof
+#define std__Rb_tree_node_base_alignof std___Rb_tree_node_base_alignof
+
 typedef struct std__set_std__string__t_s {
     char _unused;
 } __attribute__((aligned(8))) std__set_std__string__t;
 typedef std__set_std__string__t std_set_string_t;
 
+#define std__set_std__string__sizeof 48
+#define std__set_std__string__alignof 8
+#define std_set_string_sizeof std__set_std__string__sizeof
+#define std_set_string_alignof std__set_std__string__alignof
+
 typedef struct std___Rb_tree_const_iterator_std____cxx11__basic_string_char___t_s {
     std__Rb_tree_node_base_t const * _M_node;
 } __attribute__((aligned(8))) std___Rb_tree_const_iterator_std____cxx11__basic_string_char___t;
@@ -26,72 +38,72 @@ typedef std___Rb_tree_const_iterator_std____cxx11__basic_string_char___t std_set
 
 
 
+STD_EXPORT unsigned int std__set_std__string__ctor(
+    std_set_string_t * * this_);
+#define std_set_string_ctor std__set_std__string__ctor
 
 
+/** Like std_set_string_ctor, but constructs into this_, which must point to std_set_string_sizeof bytes aligned to std_set_string_alignof */
+STD_EXPORT unsigned int std__set_std__string__ctor_in_place(
+    std_set_string_t * this_);
+#define std_set_string_ctor_in_place std__set_std__string__ctor_in_place
 
 
+STD_EXPORT unsigned int std__set_std__string__dtor(
+    std_set_string_t * this_);
+#define std_set_string_dtor std__set_std__string__dtor
 
 
-
-
-unsigned int std__set_std__string__ctor(
-    std_set_string_t * * this_);
-#define std_set_string_ctor std__set_std__string__ctor
-
-
-unsigned int std__set_std__string__dtor(
+/** Like std_set_string_dtor, but leaves the storage at this_ to the caller */
+STD_EXPORT unsigned int std__set_std__string__drop_in_place(
     std_set_string_t * this_);
-#define std_set_string_dtor std__set_std__string__dtor
+#define std_set_string_drop_in_place std__set_std__string__drop_in_place
 
 
-unsigned int std__set_std__string__cbegin(
+STD_EXPORT unsigned int std__set_std__string__cbegin(
     std_set_string_t const * this_
     , std_set_string_iterator_t * return_);
 #define std_set_string_cbegin std__set_std__string__cbegin
 
 
-unsigned int std__set_std__string__cend(
+STD_EXPORT unsigned int std__set_std__string__cend(
     std_set_string_t const * this_
     , std_set_string_iterator_t * return_);
 #define std_set_string_cend std__set_std__string__cend
 
 
-unsigned int std__set_std__string__size(
+STD_EXPORT unsigned int std__set_std__string__size(
     std_set_string_t const * this_
     , unsigned long * return_);
 #define std_set_string_size std__set_std__string__size
 
 
+/** Pack all the strings into buffer, one after the other without terminators, with the offset of each in offsets followed by the end offset. The total size is written to bytes and the number of strings to count. Nothing is packed if buffer or offsets are too small. */
+STD_EXPORT unsigned int std__set_std__string__string_table(
+    std_set_string_t const * this_
+    , char * buffer
+    , size_t buffer_len
+    , size_t * offsets
+    , size_t offsets_len
+    , size_t * bytes
+    , size_t * count);
+#define std_set_string_string_table std__set_std__string__string_table
 
 
-
-
-
-
-
-
-unsigned int std___Rb_tree_const_iterator_std____cxx11__basic_string_char___deref(
+STD_EXPORT unsigned int std___Rb_tree_const_iterator_std____cxx11__basic_string_char___deref(
     std_set_string_iterator_t const * this_
     , std_string_t const * * return_);
 #define std_set_string_iterator_deref std___Rb_tree_const_iterator_std____cxx11__basic_string_char___deref
 
 
-unsigned int std___Rb_tree_const_iterator_std____cxx11__basic_string_char___inc(
+STD_EXPORT unsigned int std___Rb_tree_const_iterator_std____cxx11__basic_string_char___inc(
     std_set_string_iterator_t * this_
     , std_set_string_iterator_t * * return_);
 #define std_set_string_iterator_inc std___Rb_tree_const_iterator_std____cxx11__basic_string_char___inc
 
 
 
-
-
-
-
-
-
-
-
-unsigned int std_set_string_const_iterator_eq(
+STD_EXPORT unsigned int std_set_string_const_iterator_eq(
     _Bool * return_
     , std_set_string_iterator_t const * __x
     , std_set_string_iterator_t const * __y);
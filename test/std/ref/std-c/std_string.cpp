@@ -1,5 +1,10 @@
 #include <std_string_private.h>
 
+#include "std-errors-private.h"
+#include "std-string-table-private.h"
+#include <algorithm>
+#include <c-usestd_private.h>
+#include <cstring>
 #include <new>
 
 #include <stdexcept>
@@ -14,7 +19,7 @@ unsigned int std____cxx11__basic_string_char__assign(
         to_c(return_, (to_cpp(this_)) -> assign(s, count));
         return 0;
     } catch (std::exception& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
         return -1;
     }
 }
@@ -26,7 +31,7 @@ unsigned int std____cxx11__basic_string_char__c_str(
         *(return_) = (to_cpp(this_)) -> c_str();
         return 0;
     } catch (std::exception& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
         return -1;
     }
 }
@@ -37,7 +42,18 @@ unsigned int std__vector_std__string__vector(
         to_c(this_, new std::vector<std::string>());
         return 0;
     } catch (std::exception& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
+        return -1;
+    }
+}
+unsigned int std__vector_std__string__vector_in_place(
+    std_vector_string_t * this_)
+{
+    try {
+        new (this_) std::vector<std::string>();
+        return 0;
+    } catch (std::exception& e) {
+        tlg_set_exception_string(e.what());
         return -1;
     }
 }
@@ -48,7 +64,259 @@ unsigned int std__vector_std__string__dtor(
         delete to_cpp(this_);
         return 0;
     } catch (std::exception& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
+        return -1;
+    }
+}
+unsigned int std__vector_std__string__drop_in_place(
+    std_vector_string_t * this_)
+{
+    try {
+        (to_cpp(this_)) -> std::vector<std::__cxx11::basic_string<char>, std::allocator<std::__cxx11::basic_string<char> > >::~vector();
+        return 0;
+    } catch (std::exception& e) {
+        tlg_set_exception_string(e.what());
+        return -1;
+    }
+}
+unsigned int std__vector_std__string__string_table(
+    std_vector_string_t const * this_
+    , char * buffer
+    , size_t buffer_len
+    , size_t * offsets
+    , size_t offsets_len
+    , size_t * bytes
+    , size_t * count)
+{
+    try {
+        tlg_string_table(*(to_cpp(this_)), buffer, buffer_len, offsets, offsets_len, bytes, count);
+        return 0;
+    } catch (std::exception& e) {
+        tlg_set_exception_string(e.what());
+        return -1;
+    }
+}
+unsigned int std__vector_float__vector(
+    std_vector_float_t * * this_)
+{
+    try {
+        to_c(this_, new std::vector<float>());
+        return 0;
+    } catch (std::exception& e) {
+        tlg_set_exception_string(e.what());
+        return -1;
+    }
+}
+unsigned int std__vector_float__vector_in_place(
+    std_vector_float_t * this_)
+{
+    try {
+        new (this_) std::vector<float>();
+        return 0;
+    } catch (std::exception& e) {
+        tlg_set_exception_string(e.what());
+        return -1;
+    }
+}
+unsigned int std__vector_float__dtor(
+    std_vector_float_t * this_)
+{
+    try {
+        delete to_cpp(this_);
+        return 0;
+    } catch (std::exception& e) {
+        tlg_set_exception_string(e.what());
+        return -1;
+    }
+}
+unsigned int std__vector_float__drop_in_place(
+    std_vector_float_t * this_)
+{
+    try {
+        (to_cpp(this_)) -> std::vector<float, std::allocator<float> >::~vector();
+        return 0;
+    } catch (std::exception& e) {
+        tlg_set_exception_string(e.what());
+        return -1;
+    }
+}
+unsigned int std__vector_float__assign_from(
+    std_vector_float_t * this_
+    , float const * ptr
+    , size_t len)
+{
+    try {
+        (to_cpp(this_)) -> assign(ptr, (ptr + len));
+        return 0;
+    } catch (std::exception& e) {
+        tlg_set_exception_string(e.what());
+        return -1;
+    }
+}
+unsigned int std__vector_float__copy_to(
+    std_vector_float_t const * this_
+    , float * ptr
+    , size_t len)
+{
+    try {
+        memcpy(ptr, (to_cpp(this_)) -> data(), (std::min<size_t>(len, (to_cpp(this_)) -> size()) * sizeof(*(ptr))));
+        return 0;
+    } catch (std::exception& e) {
+        tlg_set_exception_string(e.what());
+        return -1;
+    }
+}
+unsigned int std__vector_float__size(
+    std_vector_float_t const * this_
+    , size_t * return_)
+{
+    try {
+        *(return_) = (to_cpp(this_)) -> size();
+        return 0;
+    } catch (std::exception& e) {
+        tlg_set_exception_string(e.what());
+        return -1;
+    }
+}
+unsigned int std__vector_float__data(
+    std_vector_float_t const * this_
+    , float const * * return_)
+{
+    try {
+        *(return_) = (to_cpp(this_)) -> data();
+        return 0;
+    } catch (std::exception& e) {
+        tlg_set_exception_string(e.what());
+        return -1;
+    }
+}
+unsigned int std__vector_float__data_mut(
+    std_vector_float_t * this_
+    , float * * return_)
+{
+    try {
+        *(return_) = (to_cpp(this_)) -> data();
+        return 0;
+    } catch (std::exception& e) {
+        tlg_set_exception_string(e.what());
+        return -1;
+    }
+}
+unsigned int std__vector_float__capacity(
+    std_vector_float_t const * this_
+    , size_t * return_)
+{
+    try {
+        *(return_) = (to_cpp(this_)) -> capacity();
+        return 0;
+    } catch (std::exception& e) {
+        tlg_set_exception_string(e.what());
+        return -1;
+    }
+}
+unsigned int std__vector_float__reserve(
+    std_vector_float_t * this_
+    , size_t n)
+{
+    try {
+        (to_cpp(this_)) -> reserve(n);
+        return 0;
+    } catch (std::exception& e) {
+        tlg_set_exception_string(e.what());
+        return -1;
+    }
+}
+unsigned int std__vector_float__resize(
+    std_vector_float_t * this_
+    , size_t n)
+{
+    try {
+        (to_cpp(this_)) -> resize(n);
+        return 0;
+    } catch (std::exception& e) {
+        tlg_set_exception_string(e.what());
+        return -1;
+    }
+}
+unsigned int std__vector_usestd__Tag__vector(
+    std_vector_tag_t * * this_)
+{
+    try {
+        to_c(this_, new std::vector<usestd::Tag>());
+        return 0;
+    } catch (std::exception& e) {
+        tlg_set_exception_string(e.what());
+        return -1;
+    }
+}
+unsigned int std__vector_usestd__Tag__vector_in_place(
+    std_vector_tag_t * this_)
+{
+    try {
+        new (this_) std::vector<usestd::Tag>();
+        return 0;
+    } catch (std::exception& e) {
+        tlg_set_exception_string(e.what());
+        return -1;
+    }
+}
+unsigned int std__vector_usestd__Tag__dtor(
+    std_vector_tag_t * this_)
+{
+    try {
+        delete to_cpp(this_);
+        return 0;
+    } catch (std::exception& e) {
+        tlg_set_exception_string(e.what());
+        return -1;
+    }
+}
+unsigned int std__vector_usestd__Tag__drop_in_place(
+    std_vector_tag_t * this_)
+{
+    try {
+        (to_cpp(this_)) -> std::vector<usestd::Tag, std::allocator<usestd::Tag> >::~vector();
+        return 0;
+    } catch (std::exception& e) {
+        tlg_set_exception_string(e.what());
+        return -1;
+    }
+}
+unsigned int std__vector_usestd__Tag__assign_from(
+    std_vector_tag_t * this_
+    , usestd_Tag_t const * ptr
+    , size_t len)
+{
+    try {
+        (to_cpp(this_)) -> assign(to_cpp(ptr), (to_cpp(ptr) + len));
+        return 0;
+    } catch (std::exception& e) {
+        tlg_set_exception_string(e.what());
+        return -1;
+    }
+}
+unsigned int std__vector_usestd__Tag__copy_to(
+    std_vector_tag_t const * this_
+    , usestd_Tag_t * ptr
+    , size_t len)
+{
+    try {
+        memcpy(to_cpp(ptr), (to_cpp(this_)) -> data(), (std::min<size_t>(len, (to_cpp(this_)) -> size()) * sizeof(*(to_cpp(ptr)))));
+        return 0;
+    } catch (std::exception& e) {
+        tlg_set_exception_string(e.what());
+        return -1;
+    }
+}
+unsigned int std__vector_usestd__Tag__size(
+    std_vector_tag_t const * this_
+    , size_t * return_)
+{
+    try {
+        *(return_) = (to_cpp(this_)) -> size();
+        return 0;
+    } catch (std::exception& e) {
+        tlg_set_exception_string(e.what());
         return -1;
     }
 }
@@ -1,22 +1,57 @@
 #pragma once
+#include "std-export.h"
+#include <stddef.h>
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+typedef struct usestd__Tag_t_s usestd__Tag_t;
+typedef usestd__Tag_t usestd_Tag_t;
+
 typedef struct std____cxx11__basic_string_char__t_s {
     char _unused;
 } __attribute__((aligned(8))) std____cxx11__basic_string_char__t;
 typedef std____cxx11__basic_string_char__t std_string_t;
 
+#define std____cxx11__basic_string_char__sizeof 32
+#define std____cxx11__basic_string_char__alignof 8
+#define std_string_sizeof std____cxx11__basic_string_char__sizeof
+#define std_string_alignof std____cxx11__basic_string_char__alignof
+
 typedef struct std__vector_std__string__t_s {
     char _unused;
 } __attribute__((aligned(8))) std__vector_std__string__t;
 typedef std__vector_std__string__t std_vector_string_t;
 
+#define std__vector_std__string__sizeof 24
+#define std__vector_std__string__alignof 8
+#define std_vector_string_sizeof std__vector_std__string__sizeof
+#define std_vector_string_alignof std__vector_std__string__alignof
+
+typedef struct std__vector_float__t_s {
+    char _unused;
+} __attribute__((aligned(8))) std__vector_float__t;
+typedef std__vector_float__t std_vector_float_t;
+
+#define std__vector_float__sizeof 24
+#define std__vector_float__alignof 8
+#define std_vector_float_sizeof std__vector_float__sizeof
+#define std_vector_float_alignof std__vector_float__alignof
+
+typedef struct std__vector_usestd__Tag__t_s {
+    char _unused;
+} __attribute__((aligned(8))) std__vector_usestd__Tag__t;
+typedef std__vector_usestd__Tag__t std_vector_tag_t;
+
+#define std__vector_usestd__Tag__sizeof 24
+#define std__vector_usestd__Tag__alignof 8
+#define std_vector_tag_sizeof std__vector_usestd__Tag__sizeof
+#define std_vector_tag_alignof std__vector_usestd__Tag__alignof
+
 
 
-unsigned int std____cxx11__basic_string_char__assign(
+STD_EXPORT unsigned int std____cxx11__basic_string_char__assign(
     std_string_t * this_
     , std_string_t * * return_
     , char const * s
@@ -24,36 +59,162 @@ unsigned int std____cxx11__basic_string_char__assign(
 #define std_string_assign std____cxx11__basic_string_char__assign
 
 
-unsigned int std____cxx11__basic_string_char__c_str(
+STD_EXPORT unsigned int std____cxx11__basic_string_char__c_str(
     std_string_t const * this_
     , char const * * return_);
 #define std_string_c_str std____cxx11__basic_string_char__c_str
 
 
+STD_EXPORT unsigned int std__vector_std__string__vector(
+    std_vector_string_t * * this_);
+#define std_vector_string_vector std__vector_std__string__vector
+
+
+/** Like std_vector_string_vector, but constructs into this_, which must point to std_vector_string_sizeof bytes aligned to std_vector_string_alignof */
+STD_EXPORT unsigned int std__vector_std__string__vector_in_place(
+    std_vector_string_t * this_);
+#define std_vector_string_vector_in_place std__vector_std__string__vector_in_place
 
 
+STD_EXPORT unsigned int std__vector_std__string__dtor(
+    std_vector_string_t * this_);
+#define std_vector_string_dtor std__vector_std__string__dtor
 
 
+/** Like std_vector_string_dtor, but leaves the storage at this_ to the caller */
+STD_EXPORT unsigned int std__vector_std__string__drop_in_place(
+    std_vector_string_t * this_);
+#define std_vector_string_drop_in_place std__vector_std__string__drop_in_place
 
 
+/** Pack all the strings into buffer, one after the other without terminators, with the offset of each in offsets followed by the end offset. The total size is written to bytes and the number of strings to count. Nothing is packed if buffer or offsets are too small. */
+STD_EXPORT unsigned int std__vector_std__string__string_table(
+    std_vector_string_t const * this_
+    , char * buffer
+    , size_t buffer_len
+    , size_t * offsets
+    , size_t offsets_len
+    , size_t * bytes
+    , size_t * count);
+#define std_vector_string_string_table std__vector_std__string__string_table
 
 
-unsigned int std__vector_std__string__vector(
-    std_vector_string_t * * this_);
-#define std_vector_string_vector std__vector_std__string__vector
+STD_EXPORT unsigned int std__vector_float__vector(
+    std_vector_float_t * * this_);
+#define std_vector_float_vector std__vector_float__vector
 
 
-unsigned int std__vector_std__string__dtor(
-    std_vector_string_t * this_);
-#define std_vector_string_dtor std__vector_std__string__dtor
+/** Like std_vector_float_vector, but constructs into this_, which must point to std_vector_float_sizeof bytes aligned to std_vector_float_alignof */
+STD_EXPORT unsigned int std__vector_float__vector_in_place(
+    std_vector_float_t * this_);
+#define std_vector_float_vector_in_place std__vector_float__vector_in_place
+
+
+STD_EXPORT unsigned int std__vector_float__dtor(
+    std_vector_float_t * this_);
+#define std_vector_float_dtor std__vector_float__dtor
+
+
+/** Like std_vector_float_dtor, but leaves the storage at this_ to the caller */
+STD_EXPORT unsigned int std__vector_float__drop_in_place(
+    std_vector_float_t * this_);
+#define std_vector_float_drop_in_place std__vector_float__drop_in_place
+
+
+/** Replace the contents with the len elements at ptr */
+STD_EXPORT unsigned int std__vector_float__assign_from(
+    std_vector_float_t * this_
+    , float const * ptr
+    , size_t len);
+#define std_vector_float_assign_from std__vector_float__assign_from
+
+
+/** Copy up to len elements into the already constructed elements at ptr */
+STD_EXPORT unsigned int std__vector_float__copy_to(
+    std_vector_float_t const * this_
+    , float * ptr
+    , size_t len);
+#define std_vector_float_copy_to std__vector_float__copy_to
+
+
+STD_EXPORT unsigned int std__vector_float__size(
+    std_vector_float_t const * this_
+    , size_t * return_);
+#define std_vector_float_size std__vector_float__size
+
+
+STD_EXPORT unsigned int std__vector_float__data(
+    std_vector_float_t const * this_
+    , float const * * return_);
+#define std_vector_float_data std__vector_float__data
+
+
+STD_EXPORT unsigned int std__vector_float__data_mut(
+    std_vector_float_t * this_
+    , float * * return_);
+#define std_vector_float_data_mut std__vector_float__data_mut
+
+
+STD_EXPORT unsigned int std__vector_float__capacity(
+    std_vector_float_t const * this_
+    , size_t * return_);
+#define std_vector_float_capacity std__vector_float__capacity
+
+
+STD_EXPORT unsigned int std__vector_float__reserve(
+    std_vector_float_t * this_
+    , size_t n);
+#define std_vector_float_reserve std__vector_float__reserve
+
+
+STD_EXPORT unsigned int std__vector_float__resize(
+    std_vector_float_t * this_
+    , size_t n);
+#define std_vector_float_resize std__vector_float__resize
+
+
+STD_EXPORT unsigned int std__vector_usestd__Tag__vector(
+    std_vector_tag_t * * this_);
+#define std_vector_tag_vector std__vector_usestd__Tag__vector
+
+
+/** Like std_vector_tag_vector, but constructs into this_, which must point to std_vector_tag_sizeof bytes aligned to std_vector_tag_alignof */
+STD_EXPORT unsigned int std__vector_usestd__Tag__vector_in_place(
+    std_vector_tag_t * this_);
+#define std_vector_tag_vector_in_place std__vector_usestd__Tag__vector_in_place
+
+
+STD_EXPORT unsigned int std__vector_usestd__Tag__dtor(
+    std_vector_tag_t * this_);
+#define std_vector_tag_dtor std__vector_usestd__Tag__dtor
 
 
+/** Like std_vector_tag_dtor, but leaves the storage at this_ to the caller */
+STD_EXPORT unsigned int std__vector_usestd__Tag__drop_in_place(
+    std_vector_tag_t * this_);
+#define std_vector_tag_drop_in_place std__vector_usestd__Tag__drop_in_place
 
 
+/** Replace the contents with the len elements at ptr */
+STD_EXPORT unsigned int std__vector_usestd__Tag__assign_from(
+    std_vector_tag_t * this_
+    , usestd_Tag_t const * ptr
+    , size_t len);
+#define std_vector_tag_assign_from std__vector_usestd__Tag__assign_from
 
 
+/** Copy up to len elements into the already constructed elements at ptr */
+STD_EXPORT unsigned int std__vector_usestd__Tag__copy_to(
+    std_vector_tag_t const * this_
+    , usestd_Tag_t * ptr
+    , size_t len);
+#define std_vector_tag_copy_to std__vector_usestd__Tag__copy_to
 
 
+STD_EXPORT unsigned int std__vector_usestd__Tag__size(
+    std_vector_tag_t const * this_
+    , size_t * return_);
+#define std_vector_tag_size std__vector_usestd__Tag__size
 
 #ifdef __cplusplus
 }
@@ -5,6 +5,18 @@
 use crate::*;
 use std::os::raw::*;
 
+#[repr(C, align(4))]
+#[derive(Clone)]
+pub struct usestd__Tag_t {
+    _inner: [u8; 8]
+}
+
+impl Default for usestd__Tag_t {
+    fn default() -> Self {
+        Self { _inner: [0u8; 8] }
+    }
+}
+
 
 
 extern "C" {
@@ -13,5 +25,7 @@ pub fn usestd_takes_string(s: *const std_string_t) -> Exception;
 
 pub fn usestd_takes_vector_string(v: *const std_vector_string_t) -> Exception;
 
+pub fn usestd_fill_names(v: *mut std_vector_string_t) -> Exception;
+
 
 } // extern "C"
@@ -41,31 +41,102 @@ extern {
     pub fn std_get_exception_string() -> *const std::os::raw::c_char;
 }
 
+
+/// Strings packed into a single buffer by a container's string_table()
+pub struct StringTable {
+    data: Vec<u8>,
+    offsets: Vec<usize>,
+}
+
+impl StringTable {
+    pub fn len(&self) -> usize {
+        self.offsets.len() - 1
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.len() == 0
+    }
+
+    /// The bytes of the string at index i
+    pub fn get_bytes(&self, i: usize) -> &[u8] {
+        &self.data[self.offsets[i]..self.offsets[i + 1]]
+    }
+
+    /// The string at index i, or None if it is not valid UTF-8
+    pub fn get(&self, i: usize) -> Option<&str> {
+        std::str::from_utf8(self.get_bytes(i)).ok()
+    }
+
+    pub fn iter(&self) -> impl Iterator<Item = Option<&str>> {
+        (0..self.len()).map(move |i| self.get(i))
+    }
+}
 pub mod c_usestd;
+pub use c_usestd::usestd__Tag_t as usestd_Tag_t;
 
 pub use c_usestd::usestd_takes_string as usestd_takes_string;
 pub use c_usestd::usestd_takes_vector_string as usestd_takes_vector_string;
+pub use c_usestd::usestd_fill_names as usestd_fill_names;
 pub mod std_set;
 pub use std_set::std___Rb_tree_node_base_t as std__Rb_tree_node_base_t;
+pub use std_set::std___Rb_tree_node_base_sizeof as std__Rb_tree_node_base_sizeof;
+pub use std_set::std___Rb_tree_node_base_alignof as std__Rb_tree_node_base_alignof;
 pub use std_set::std__set_std__string__t as std_set_string_t;
+pub use std_set::std__set_std__string__sizeof as std_set_string_sizeof;
+pub use std_set::std__set_std__string__alignof as std_set_string_alignof;
 pub use std_set::std___Rb_tree_const_iterator_std____cxx11__basic_string_char___t as std_set_string_iterator_t;
 
 pub use std_set::std__set_std__string__ctor as std_set_string_ctor;
+pub use std_set::std__set_std__string__ctor_in_place as std_set_string_ctor_in_place;
 pub use std_set::std__set_std__string__dtor as std_set_string_dtor;
+pub use std_set::std__set_std__string__drop_in_place as std_set_string_drop_in_place;
 pub use std_set::std__set_std__string__cbegin as std_set_string_cbegin;
 pub use std_set::std__set_std__string__cend as std_set_string_cend;
 pub use std_set::std__set_std__string__size as std_set_string_size;
+pub use std_set::std__set_std__string__string_table as std_set_string_string_table;
 pub use std_set::std___Rb_tree_const_iterator_std____cxx11__basic_string_char___deref as std_set_string_iterator_deref;
 pub use std_set::std___Rb_tree_const_iterator_std____cxx11__basic_string_char___inc as std_set_string_iterator_inc;
 pub use std_set::std_set_string_const_iterator_eq as std_set_string_const_iterator_eq;
 pub mod std_string;
 pub use std_string::std____cxx11__basic_string_char__t as std_string_t;
+pub use std_string::std____cxx11__basic_string_char__sizeof as std_string_sizeof;
+pub use std_string::std____cxx11__basic_string_char__alignof as std_string_alignof;
 pub use std_string::std__vector_std__string__t as std_vector_string_t;
+pub use std_string::std__vector_std__string__sizeof as std_vector_string_sizeof;
+pub use std_string::std__vector_std__string__alignof as std_vector_string_alignof;
+pub use std_string::std__vector_float__t as std_vector_float_t;
+pub use std_string::std__vector_float__sizeof as std_vector_float_sizeof;
+pub use std_string::std__vector_float__alignof as std_vector_float_alignof;
+pub use std_string::std__vector_usestd__Tag__t as std_vector_tag_t;
+pub use std_string::std__vector_usestd__Tag__sizeof as std_vector_tag_sizeof;
+pub use std_string::std__vector_usestd__Tag__alignof as std_vector_tag_alignof;
 
 pub use std_string::std____cxx11__basic_string_char__assign as std_string_assign;
 pub use std_string::std____cxx11__basic_string_char__c_str as std_string_c_str;
 pub use std_string::std__vector_std__string__vector as std_vector_string_vector;
+pub use std_string::std__vector_std__string__vector_in_place as std_vector_string_vector_in_place;
 pub use std_string::std__vector_std__string__dtor as std_vector_string_dtor;
+pub use std_string::std__vector_std__string__drop_in_place as std_vector_string_drop_in_place;
+pub use std_string::std__vector_std__string__string_table as std_vector_string_string_table;
+pub use std_string::std__vector_float__vector as std_vector_float_vector;
+pub use std_string::std__vector_float__vector_in_place as std_vector_float_vector_in_place;
+pub use std_string::std__vector_float__dtor as std_vector_float_dtor;
+pub use std_string::std__vector_float__drop_in_place as std_vector_float_drop_in_place;
+pub use std_string::std__vector_float__assign_from as std_vector_float_assign_from;
+pub use std_string::std__vector_float__copy_to as std_vector_float_copy_to;
+pub use std_string::std__vector_float__size as std_vector_float_size;
+pub use std_string::std__vector_float__data as std_vector_float_data;
+pub use std_string::std__vector_float__data_mut as std_vector_float_data_mut;
+pub use std_string::std__vector_float__capacity as std_vector_float_capacity;
+pub use std_string::std__vector_float__reserve as std_vector_float_reserve;
+pub use std_string::std__vector_float__resize as std_vector_float_resize;
+pub use std_string::std__vector_usestd__Tag__vector as std_vector_tag_vector;
+pub use std_string::std__vector_usestd__Tag__vector_in_place as std_vector_tag_vector_in_place;
+pub use std_string::std__vector_usestd__Tag__dtor as std_vector_tag_dtor;
+pub use std_string::std__vector_usestd__Tag__drop_in_place as std_vector_tag_drop_in_place;
+pub use std_string::std__vector_usestd__Tag__assign_from as std_vector_tag_assign_from;
+pub use std_string::std__vector_usestd__Tag__copy_to as std_vector_tag_copy_to;
+pub use std_string::std__vector_usestd__Tag__size as std_vector_tag_size;
 
 
 #[cfg(test)]
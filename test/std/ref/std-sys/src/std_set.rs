@@ -9,10 +9,31 @@ use std::os::raw::*;
 pub struct std___Rb_tree_node_base_t {
     _unused: [u8; 0],
 }
+
+pub const std___Rb_tree_node_base_sizeof: usize = 32;
+pub const std___Rb_tree_node_base_alignof: usize = 8;
+
 #[repr(C)]
 pub struct std__set_std__string__t {
     _unused: [u8; 0],
 }
+
+pub const std__set_std__string__sizeof: usize = 48;
+pub const std__set_std__string__alignof: usize = 8;
+
+impl std__set_std__string__t {
+    /// Copy all the strings out in a single packed table.
+    pub unsafe fn string_table(&self) -> StringTable {
+        let mut bytes = 0;
+        let mut count = 0;
+        std__set_std__string__string_table(self, std::ptr::null_mut(), 0, std::ptr::null_mut(), 0, &mut bytes, &mut count);
+        let mut data = vec![0u8; bytes];
+        let mut offsets = vec![0; count + 1];
+        std__set_std__string__string_table(self, data.as_mut_ptr() as *mut c_char, bytes, offsets.as_mut_ptr(), count + 1, &mut bytes, &mut count);
+        StringTable { data, offsets }
+    }
+}
+
 #[repr(C, align(8))]
 #[derive(Clone)]
 pub struct std___Rb_tree_const_iterator_std____cxx11__basic_string_char___t {
@@ -25,14 +46,23 @@ extern "C" {
 
 pub fn std__set_std__string__ctor(this_: *mut *mut std_set_string_t) -> Exception;
 
+/// Like std_set_string_ctor, but constructs into this_, which must point to std_set_string_sizeof bytes aligned to std_set_string_alignof
+pub fn std__set_std__string__ctor_in_place(this_: *mut std_set_string_t) -> Exception;
+
 pub fn std__set_std__string__dtor(this_: *mut std_set_string_t) -> Exception;
 
+/// Like std_set_string_dtor, but leaves the storage at this_ to the caller
+pub fn std__set_std__string__drop_in_place(this_: *mut std_set_string_t) -> Exception;
+
 pub fn std__set_std__string__cbegin(this_: *const std_set_string_t, return_: *mut std_set_string_iterator_t) -> Exception;
 
 pub fn std__set_std__string__cend(this_: *const std_set_string_t, return_: *mut std_set_string_iterator_t) -> Exception;
 
 pub fn std__set_std__string__size(this_: *const std_set_string_t, return_: *mut c_ulong) -> Exception;
 
+/// Pack all the strings into buffer, one after the other without terminators, with the offset of each in offsets followed by the end offset. The total size is written to bytes and the number of strings to count. Nothing is packed if buffer or offsets are too small.
+pub fn std__set_std__string__string_table(this_: *const std_set_string_t, buffer: *mut c_char, buffer_len: usize, offsets: *mut usize, offsets_len: usize, bytes: *mut usize, count: *mut usize) -> Exception;
+
 pub fn std___Rb_tree_const_iterator_std____cxx11__basic_string_char___deref(this_: *const std_set_string_iterator_t, return_: *mut *const std_string_t) -> Exception;
 
 pub fn std___Rb_tree_const_iterator_std____cxx11__basic_string_char___inc(this_: *mut std_set_string_iterator_t, return_: *mut *mut std_set_string_iterator_t) -> Exception;
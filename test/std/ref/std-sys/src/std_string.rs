@@ -9,11 +9,76 @@ use std::os::raw::*;
 pub struct std____cxx11__basic_string_char__t {
     _unused: [u8; 0],
 }
+
+pub const std____cxx11__basic_string_char__sizeof: usize = 32;
+pub const std____cxx11__basic_string_char__alignof: usize = 8;
+
 #[repr(C)]
 pub struct std__vector_std__string__t {
     _unused: [u8; 0],
 }
 
+pub const std__vector_std__string__sizeof: usize = 24;
+pub const std__vector_std__string__alignof: usize = 8;
+
+impl std__vector_std__string__t {
+    /// Copy all the strings out in a single packed table.
+    pub unsafe fn string_table(&self) -> StringTable {
+        let mut bytes = 0;
+        let mut count = 0;
+        std__vector_std__string__string_table(self, std::ptr::null_mut(), 0, std::ptr::null_mut(), 0, &mut bytes, &mut count);
+        let mut data = vec![0u8; bytes];
+        let mut offsets = vec![0; count + 1];
+        std__vector_std__string__string_table(self, data.as_mut_ptr() as *mut c_char, bytes, offsets.as_mut_ptr(), count + 1, &mut bytes, &mut count);
+        StringTable { data, offsets }
+    }
+}
+
+#[repr(C)]
+pub struct std__vector_float__t {
+    _unused: [u8; 0],
+}
+
+pub const std__vector_float__sizeof: usize = 24;
+pub const std__vector_float__alignof: usize = 8;
+
+impl std__vector_float__t {
+    /// Borrow the contents as a slice, without copying.
+    pub unsafe fn as_slice(&self) -> &[c_float] {
+        let mut data = std::ptr::null();
+        let mut size = 0;
+        std__vector_float__data(self, &mut data);
+        std__vector_float__size(self, &mut size);
+        if size == 0 {
+            &[]
+        } else {
+            std::slice::from_raw_parts(data, size)
+        }
+    }
+
+    /// Mutably borrow the contents as a slice, without copying.
+    pub unsafe fn as_mut_slice(&mut self) -> &mut [c_float] {
+        let mut data = std::ptr::null_mut();
+        let mut size = 0;
+        std__vector_float__data_mut(self, &mut data);
+        std__vector_float__size(self, &mut size);
+        if size == 0 {
+            &mut []
+        } else {
+            std::slice::from_raw_parts_mut(data, size)
+        }
+    }
+}
+
+#[repr(C)]
+pub struct std__vector_usestd__Tag__t {
+    _unused: [u8; 0],
+}
+
+pub const std__vector_usestd__Tag__sizeof: usize = 24;
+pub const std__vector_usestd__Tag__alignof: usize = 8;
+
+
 
 extern "C" {
 
@@ -23,7 +88,62 @@ pub fn std____cxx11__basic_string_char__c_str(this_: *const std_string_t, return
 
 pub fn std__vector_std__string__vector(this_: *mut *mut std_vector_string_t) -> Exception;
 
+/// Like std_vector_string_vector, but constructs into this_, which must point to std_vector_string_sizeof bytes aligned to std_vector_string_alignof
+pub fn std__vector_std__string__vector_in_place(this_: *mut std_vector_string_t) -> Exception;
+
 pub fn std__vector_std__string__dtor(this_: *mut std_vector_string_t) -> Exception;
 
+/// Like std_vector_string_dtor, but leaves the storage at this_ to the caller
+pub fn std__vector_std__string__drop_in_place(this_: *mut std_vector_string_t) -> Exception;
+
+/// Pack all the strings into buffer, one after the other without terminators, with the offset of each in offsets followed by the end offset. The total size is written to bytes and the number of strings to count. Nothing is packed if buffer or offsets are too small.
+pub fn std__vector_std__string__string_table(this_: *const std_vector_string_t, buffer: *mut c_char, buffer_len: usize, offsets: *mut usize, offsets_len: usize, bytes: *mut usize, count: *mut usize) -> Exception;
+
+pub fn std__vector_float__vector(this_: *mut *mut std_vector_float_t) -> Exception;
+
+/// Like std_vector_float_vector, but constructs into this_, which must point to std_vector_float_sizeof bytes aligned to std_vector_float_alignof
+pub fn std__vector_float__vector_in_place(this_: *mut std_vector_float_t) -> Exception;
+
+pub fn std__vector_float__dtor(this_: *mut std_vector_float_t) -> Exception;
+
+/// Like std_vector_float_dtor, but leaves the storage at this_ to the caller
+pub fn std__vector_float__drop_in_place(this_: *mut std_vector_float_t) -> Exception;
+
+/// Replace the contents with the len elements at ptr
+pub fn std__vector_float__assign_from(this_: *mut std_vector_float_t, ptr: *const c_float, len: usize) -> Exception;
+
+/// Copy up to len elements into the already constructed elements at ptr
+pub fn std__vector_float__copy_to(this_: *const std_vector_float_t, ptr: *mut c_float, len: usize) -> Exception;
+
+pub fn std__vector_float__size(this_: *const std_vector_float_t, return_: *mut usize) -> Exception;
+
+pub fn std__vector_float__data(this_: *const std_vector_float_t, return_: *mut *const c_float) -> Exception;
+
+pub fn std__vector_float__data_mut(this_: *mut std_vector_float_t, return_: *mut *mut c_float) -> Exception;
+
+pub fn std__vector_float__capacity(this_: *const std_vector_float_t, return_: *mut usize) -> Exception;
+
+pub fn std__vector_float__reserve(this_: *mut std_vector_float_t, n: usize) -> Exception;
+
+pub fn std__vector_float__resize(this_: *mut std_vector_float_t, n: usize) -> Exception;
+
+pub fn std__vector_usestd__Tag__vector(this_: *mut *mut std_vector_tag_t) -> Exception;
+
+/// Like std_vector_tag_vector, but constructs into this_, which must point to std_vector_tag_sizeof bytes aligned to std_vector_tag_alignof
+pub fn std__vector_usestd__Tag__vector_in_place(this_: *mut std_vector_tag_t) -> Exception;
+
+pub fn std__vector_usestd__Tag__dtor(this_: *mut std_vector_tag_t) -> Exception;
+
+/// Like std_vector_tag_dtor, but leaves the storage at this_ to the caller
+pub fn std__vector_usestd__Tag__drop_in_place(this_: *mut std_vector_tag_t) -> Exception;
+
+/// Replace the contents with the len elements at ptr
+pub fn std__vector_usestd__Tag__assign_from(this_: *mut std_vector_tag_t, ptr: *const usestd_Tag_t, len: usize) -> Exception;
+
+/// Copy up to len elements into the already constructed elements at ptr
+pub fn std__vector_usestd__Tag__copy_to(this_: *const std_vector_tag_t, ptr: *mut usestd_Tag_t, len: usize) -> Exception;
+
+pub fn std__vector_usestd__Tag__size(this_: *const std_vector_tag_t, return_: *mut usize) -> Exception;
+
 
 } // extern "C"
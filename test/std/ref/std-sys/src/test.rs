@@ -1,7 +1,155 @@
-// Empty dummy test file for automated testing. This will be replaced by a 
-// file copied in from the test suite
+use crate::*;
+use std::os::raw::c_char;
 
 #[test]
-fn it_works() {
-    assert!(true, "It works!");
-}
\ No newline at end of file
+fn empty_string_table() {
+    unsafe {
+        let mut set = std::ptr::null_mut();
+        std_set_string_ctor(&mut set);
+
+        let table = (*set).string_table();
+        assert!(table.is_empty());
+        assert_eq!(table.iter().count(), 0);
+
+        std_set_string_dtor(set);
+    }
+}
+
+#[test]
+fn string_table() {
+    unsafe {
+        let mut v = std::ptr::null_mut();
+        std_vector_string_vector(&mut v);
+        usestd_fill_names(v);
+
+        let table = (*v).string_table();
+        assert_eq!(table.len(), 3);
+        assert_eq!(table.offsets, [0, 5, 5, 10]);
+        assert_eq!(table.data, b"alphagamma");
+        assert_eq!(table.get(0), Some("alpha"));
+        assert_eq!(table.get(1), Some(""));
+        assert_eq!(table.get(2), Some("gamma"));
+
+        std_vector_string_dtor(v);
+    }
+}
+
+#[test]
+fn string_table_buffer_too_small() {
+    unsafe {
+        let mut v = std::ptr::null_mut();
+        std_vector_string_vector(&mut v);
+        usestd_fill_names(v);
+
+        // The sizes are reported, but nothing is packed
+        let mut buffer = [b'x' as c_char; 4];
+        let mut offsets = [99; 4];
+        let mut bytes = 0;
+        let mut count = 0;
+        std_vector_string_string_table(
+            v,
+            buffer.as_mut_ptr(),
+            buffer.len(),
+            offsets.as_mut_ptr(),
+            offsets.len(),
+            &mut bytes,
+            &mut count,
+        );
+        assert_eq!(bytes, 10);
+        assert_eq!(count, 3);
+        assert_eq!(buffer, [b'x' as c_char; 4]);
+        assert_eq!(offsets, [99; 4]);
+
+        std_vector_string_dtor(v);
+    }
+}
+
+#[test]
+fn vector_slices() {
+    unsafe {
+        let mut v = std::ptr::null_mut();
+        std_vector_float_vector(&mut v);
+        assert!((*v).as_slice().is_empty());
+        assert!((*v).as_mut_slice().is_empty());
+
+        std_vector_float_resize(v, 4);
+        let mut size = 0;
+        std_vector_float_size(v, &mut size);
+        assert_eq!(size, 4);
+        assert_eq!((*v).as_slice(), [0.0; 4]);
+
+        // Writes through the mutable slice land in the vector's storage
+        for (i, x) in (*v).as_mut_slice().iter_mut().enumerate() {
+            *x = i as f32 * 0.5;
+        }
+        assert_eq!((*v).as_slice(), [0.0, 0.5, 1.0, 1.5]);
+
+        let mut data = std::ptr::null();
+        std_vector_float_data(v, &mut data);
+        assert_eq!(data, (*v).as_slice().as_ptr());
+
+        std_vector_float_reserve(v, 16);
+        let mut capacity = 0;
+        std_vector_float_capacity(v, &mut capacity);
+        assert!(capacity >= 16);
+        assert_eq!((*v).as_slice(), [0.0, 0.5, 1.0, 1.5]);
+
+        std_vector_float_dtor(v);
+    }
+}
+
+#[test]
+fn vector_copies() {
+    unsafe {
+        let mut v = std::ptr::null_mut();
+        std_vector_float_vector(&mut v);
+
+        let values = [1.0, 2.0, 3.0];
+        std_vector_float_assign_from(v, values.as_ptr(), values.len());
+        assert_eq!((*v).as_slice(), values);
+
+        // Only as many elements as fit are copied out
+        let mut short = [0.0; 2];
+        std_vector_float_copy_to(v, short.as_mut_ptr(), short.len());
+        assert_eq!(short, [1.0, 2.0]);
+
+        let mut long = [-1.0; 5];
+        std_vector_float_copy_to(v, long.as_mut_ptr(), long.len());
+        assert_eq!(long, [1.0, 2.0, 3.0, -1.0, -1.0]);
+
+        // Assigning replaces the contents rather than appending
+        std_vector_float_assign_from(v, values[1..].as_ptr(), 2);
+        assert_eq!((*v).as_slice(), [2.0, 3.0]);
+        std_vector_float_assign_from(v, std::ptr::null(), 0);
+        assert!((*v).as_slice().is_empty());
+
+        std_vector_float_dtor(v);
+    }
+}
+
+#[test]
+fn vector_copies_records() {
+    unsafe {
+        // Tag is an opaque bytes record, so fill it through its bytes
+        let tags: Vec<usestd_Tag_t> = (0..3u8)
+            .map(|i| std::mem::transmute([i; 8]))
+            .collect();
+
+        let mut v = std::ptr::null_mut();
+        std_vector_tag_vector(&mut v);
+        std_vector_tag_assign_from(v, tags.as_ptr(), tags.len());
+
+        let mut size = 0;
+        std_vector_tag_size(v, &mut size);
+        assert_eq!(size, 3);
+
+        let mut out = vec![usestd_Tag_t::default(); 3];
+        std_vector_tag_copy_to(v, out.as_mut_ptr(), out.len());
+        for (i, tag) in out.into_iter().enumerate() {
+            let bytes: [u8; 8] = std::mem::transmute(tag);
+            assert_eq!(bytes, [i as u8; 8]);
+        }
+
+        std_vector_tag_dtor(v);
+    }
+}
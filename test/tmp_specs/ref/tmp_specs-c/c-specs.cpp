@@ -1,5 +1,6 @@
 #include <c-specs_private.h>
 
+#include "tmp_specs-errors-private.h"
 
 #include <stdexcept>
 
@@ -11,7 +12,7 @@ unsigned int specs__Attribute_int__value(
         *(return_) = &((to_cpp(this_)) -> value());
         return 0;
     } catch (std::exception& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
         return -1;
     }
 }
@@ -23,7 +24,7 @@ unsigned int specs__Attribute_float__value(
         *(return_) = &((to_cpp(this_)) -> value());
         return 0;
     } catch (std::exception& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
         return -1;
     }
 }
@@ -36,7 +37,7 @@ unsigned int specs__Specs_findAttribute_int(
         to_c(return_, (to_cpp(this_)) -> findAttribute<specs::Attribute<int>>(name));
         return 0;
     } catch (std::exception& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
         return -1;
     }
 }
@@ -49,7 +50,7 @@ unsigned int specs__Specs_findAttribute_float(
         to_c(return_, (to_cpp(this_)) -> findAttribute<specs::Attribute<float>>(name));
         return 0;
     } catch (std::exception& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
         return -1;
     }
 }
@@ -62,7 +63,7 @@ unsigned int specs__Specs_findAttribute_int_const(
         to_c(return_, (to_cpp(this_)) -> findAttribute<specs::Attribute<int>>(name));
         return 0;
     } catch (std::exception& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
         return -1;
     }
 }
@@ -75,7 +76,7 @@ unsigned int specs__Specs_findAttribute_float_const(
         to_c(return_, (to_cpp(this_)) -> findAttribute<specs::Attribute<float>>(name));
         return 0;
     } catch (std::exception& e) {
-        TLG_EXCEPTION_STRING = e.what();
+        tlg_set_exception_string(e.what());
         return -1;
     }
 }
@@ -1,4 +1,5 @@
 #pragma once
+#include "tmp_specs-export.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -9,84 +10,75 @@ typedef struct specs__Attribute_int__t_s {
 } __attribute__((aligned(4))) specs__Attribute_int__t;
 typedef specs__Attribute_int__t specs_IntAttribute_t;
 
+#define specs__Attribute_int__sizeof 4
+#define specs__Attribute_int__alignof 4
+#define specs_IntAttribute_sizeof specs__Attribute_int__sizeof
+#define specs_IntAttribute_alignof specs__Attribute_int__alignof
+
 typedef struct specs__Attribute_float__t_s {
     char _unused;
 } __attribute__((aligned(4))) specs__Attribute_float__t;
 typedef specs__Attribute_float__t specs_FloatAttribute_t;
 
+#define specs__Attribute_float__sizeof 4
+#define specs__Attribute_float__alignof 4
+#define specs_FloatAttribute_sizeof specs__Attribute_float__sizeof
+#define specs_FloatAttribute_alignof specs__Attribute_float__alignof
+
 typedef struct specs__Specs_t_s {
     char _unused;
 } __attribute__((aligned(1))) specs__Specs_t;
 typedef specs__Specs_t specs_Specs_t;
 
+#define specs__Specs_sizeof 1
+#define specs__Specs_alignof 1
+#define specs_Specs_sizeof specs__Specs_sizeof
+#define specs_Specs_alignof specs__Specs_alignof
 
 
-unsigned int specs__Attribute_int__value(
+
+TMP_SPECS_EXPORT unsigned int specs__Attribute_int__value(
     specs_IntAttribute_t * this_
     , int const * * return_);
 #define specs_IntAttribute_value specs__Attribute_int__value
 
 
 
-
-
-
-
-
-
-
-
-unsigned int specs__Attribute_float__value(
+TMP_SPECS_EXPORT unsigned int specs__Attribute_float__value(
     specs_FloatAttribute_t * this_
     , float const * * return_);
 #define specs_FloatAttribute_value specs__Attribute_float__value
 
 
 
-
-
-
-
-
-
-
-
-unsigned int specs__Specs_findAttribute_int(
+TMP_SPECS_EXPORT unsigned int specs__Specs_findAttribute_int(
     specs_Specs_t * this_
     , specs_IntAttribute_t * * return_
     , char const * name);
 #define specs_Specs_findAttribute_int specs__Specs_findAttribute_int
 
 
-unsigned int specs__Specs_findAttribute_float(
+TMP_SPECS_EXPORT unsigned int specs__Specs_findAttribute_float(
     specs_Specs_t * this_
     , specs_FloatAttribute_t * * return_
     , char const * name);
 #define specs_Specs_findAttribute_float specs__Specs_findAttribute_float
 
 
-unsigned int specs__Specs_findAttribute_int_const(
+TMP_SPECS_EXPORT unsigned int specs__Specs_findAttribute_int_const(
     specs_Specs_t const * this_
     , specs_IntAttribute_t const * * return_
     , char const * name);
 #define specs_Specs_findAttribute_int_const specs__Specs_findAttribute_int_const
 
 
-unsigned int specs__Specs_findAttribute_float_const(
+TMP_SPECS_EXPORT unsigned int specs__Specs_findAttribute_float_const(
     specs_Specs_t const * this_
     , specs_FloatAttribute_t const * * return_
     , char const * name);
 #define specs_Specs_findAttribute_float_const specs__Specs_findAttribute_float_const
 
 
-
-
-
-
-
-
-
-
 #ifdef __cplusplus
 }
 #endif
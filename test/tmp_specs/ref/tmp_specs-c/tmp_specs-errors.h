@@ -1,9 +1,10 @@
 #pragma once
+#include "tmp_specs-export.h"
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-const char* tmp_specs_get_exception_string();
+TMP_SPECS_EXPORT const char* tmp_specs_get_exception_string();
 
 #ifdef __cplusplus
 }
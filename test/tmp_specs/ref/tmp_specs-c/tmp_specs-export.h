@@ -0,0 +1,5 @@
+#pragma once
+
+#ifndef TMP_SPECS_EXPORT
+#define TMP_SPECS_EXPORT __attribute__((visibility("default")))
+#endif
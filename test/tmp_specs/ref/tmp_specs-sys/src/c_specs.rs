@@ -9,15 +9,27 @@ use std::os::raw::*;
 pub struct specs__Attribute_int__t {
     _unused: [u8; 0],
 }
+
+pub const specs__Attribute_int__sizeof: usize = 4;
+pub const specs__Attribute_int__alignof: usize = 4;
+
 #[repr(C)]
 pub struct specs__Attribute_float__t {
     _unused: [u8; 0],
 }
+
+pub const specs__Attribute_float__sizeof: usize = 4;
+pub const specs__Attribute_float__alignof: usize = 4;
+
 #[repr(C)]
 pub struct specs__Specs_t {
     _unused: [u8; 0],
 }
 
+pub const specs__Specs_sizeof: usize = 1;
+pub const specs__Specs_alignof: usize = 1;
+
+
 
 extern "C" {
 
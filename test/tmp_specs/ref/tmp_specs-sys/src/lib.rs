@@ -43,8 +43,14 @@ extern {
 
 pub mod c_specs;
 pub use c_specs::specs__Attribute_int__t as specs_IntAttribute_t;
+pub use c_specs::specs__Attribute_int__sizeof as specs_IntAttribute_sizeof;
+pub use c_specs::specs__Attribute_int__alignof as specs_IntAttribute_alignof;
 pub use c_specs::specs__Attribute_float__t as specs_FloatAttribute_t;
+pub use c_specs::specs__Attribute_float__sizeof as specs_FloatAttribute_sizeof;
+pub use c_specs::specs__Attribute_float__alignof as specs_FloatAttribute_alignof;
 pub use c_specs::specs__Specs_t as specs_Specs_t;
+pub use c_specs::specs__Specs_sizeof as specs_Specs_sizeof;
+pub use c_specs::specs__Specs_alignof as specs_Specs_alignof;
 
 pub use c_specs::specs__Attribute_int__value as specs_IntAttribute_value;
 pub use c_specs::specs__Attribute_float__value as specs_FloatAttribute_value;